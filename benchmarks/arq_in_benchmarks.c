@@ -0,0 +1,3 @@
+#define ARQ_IMPLEMENTATION
+#include "arq_in_benchmarks.h"
+
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ARQ_BENCHMARK_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define ARQ_BENCHMARK_TSC 1
+#endif
+
+namespace arq_bench {
+
+// Time-stamp-counter ticks on x86 (close to core cycles when the clock is fixed), nanoseconds elsewhere.
+inline std::uint64_t Ticks()
+{
+#if defined(ARQ_BENCHMARK_TSC)
+    return (std::uint64_t)__rdtsc();
+#else
+    return (std::uint64_t)std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline char const *TickUnit()
+{
+#if defined(ARQ_BENCHMARK_TSC)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+// Best-of-N average ticks per call of f(); the minimum filters out preemption and frequency ramps.
+template< typename F >
+double TicksPerCall(F f, unsigned calls_per_run = 20000, unsigned runs = 15)
+{
+    double best = 0;
+    for (auto r = 0u; r < runs; ++r) {
+        std::uint64_t const start = Ticks();
+        for (auto i = 0u; i < calls_per_run; ++i) {
+            f(i);
+        }
+        double const t = (double)(Ticks() - start) / calls_per_run;
+        best = (r == 0 || t < best) ? t : best;
+    }
+    return best;
+}
+
+}
+
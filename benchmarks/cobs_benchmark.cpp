@@ -0,0 +1,85 @@
+#include "arq_in_benchmarks.h"
+#include "benchmark.h"
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+unsigned const FrameLen = 256;
+
+// zero_one_in == 0 means uniformly random bytes (~1 zero in 256), otherwise ~1 zero in zero_one_in.
+std::vector< arq_uchar_t > MakeFrames(unsigned count, unsigned zero_one_in, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::vector< arq_uchar_t > frames(count * FrameLen);
+    for (auto &b : frames) {
+        unsigned const r = (unsigned)rng();
+        if (zero_one_in == 0) {
+            b = (arq_uchar_t)r;
+        } else {
+            b = ((r >> 8) % zero_one_in) ? (arq_uchar_t)(r | 1) : 0;
+        }
+    }
+    return frames;
+}
+
+volatile unsigned g_sink;
+
+}
+
+int main()
+{
+    struct Payload { char const *name; unsigned zero_one_in; };
+    Payload const payloads[] = {
+        { "random", 0 }, { "zero-heavy (1 in 8)", 8 }, { "zero-heavy (1 in 2)", 2 }, { "no zeros", 0xFFFFFFFFu }
+    };
+    unsigned const frame_count = 64;
+    unsigned const payload_len = FrameLen - ARQ__FRAME_COBS_OVERHEAD;
+
+    std::printf("COBS, %u-byte frames, ARQ_USE_INTRINSICS=%d, %s per payload byte\n",
+                FrameLen, ARQ_USE_INTRINSICS, arq_bench::TickUnit());
+    std::printf("%-22s %10s %10s %10s\n", "payload", "find_zero", "encode", "decode");
+
+    for (auto const &p : payloads) {
+        std::vector< arq_uchar_t > const raw = MakeFrames(frame_count, p.zero_one_in, 1234);
+        std::vector< arq_uchar_t > encoded = raw;
+        for (auto i = 0u; i < frame_count; ++i) {
+            arq__cobs_encode(&encoded[i * FrameLen], FrameLen);
+        }
+        std::vector< arq_uchar_t > work(FrameLen);
+
+        double const copy = arq_bench::TicksPerCall([&](unsigned i) {
+            std::memcpy(work.data(), &raw[(i % frame_count) * FrameLen], FrameLen);
+            g_sink = work[i % FrameLen];
+        });
+        double const find_zero = arq_bench::TicksPerCall([&](unsigned i) {
+            arq_uchar_t const *f = &raw[(i % frame_count) * FrameLen];
+            unsigned n = 0, ofs = 0;
+            while (ofs < FrameLen) {
+                ofs += arq__find_zero(f + ofs, FrameLen - ofs) + 1;
+                ++n;
+            }
+            g_sink = n;
+        });
+        double const encode = arq_bench::TicksPerCall([&](unsigned i) {
+            std::memcpy(work.data(), &raw[(i % frame_count) * FrameLen], FrameLen);
+            arq__cobs_encode(work.data(), FrameLen);
+            g_sink = work[i % FrameLen];
+        });
+        double const decode = arq_bench::TicksPerCall([&](unsigned i) {
+            std::memcpy(work.data(), &encoded[(i % frame_count) * FrameLen], FrameLen);
+            arq__cobs_decode(work.data(), FrameLen);
+            g_sink = work[i % FrameLen];
+        });
+
+        std::printf("%-22s %10.3f %10.3f %10.3f\n",
+                    p.name,
+                    find_zero / FrameLen,
+                    (encode - copy) / payload_len,
+                    (decode - copy) / payload_len);
+    }
+    return 0;
+}
+
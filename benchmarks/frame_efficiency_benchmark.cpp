@@ -0,0 +1,129 @@
+#include "arq_in_benchmarks.h"
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+struct Wire
+{
+    unsigned long payload = 0;
+    unsigned long data_bytes = 0;
+    unsigned long ack_bytes = 0;
+};
+
+// 16-byte telemetry samples, one message each, so header overhead dominates every data frame.
+arq_cfg_t MakeCfg(arq_bool_t compact_header, arq_bool_t compact_acks)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 16;
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 32;
+    cfg.recv_window_size_in_messages = 32;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.tinygram_send_delay = 0;
+    cfg.inter_segment_timeout = 10;
+    cfg.keepalive_period = 1000;
+    cfg.disconnect_timeout = 5000;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = compact_acks;
+    cfg.compact_header = compact_header;
+    cfg.ack_delay = 0;
+    return cfg;
+}
+
+struct Peer
+{
+    explicit Peer(arq_cfg_t const &cfg)
+    {
+        unsigned size = 0;
+        ok = (arq_required_size(&cfg, &size) == ARQ_OK_COMPLETED);
+        seat.resize(size);
+        ok = ok && (arq_init(&cfg, seat.data(), size, &arq) == ARQ_OK_COMPLETED);
+    }
+    std::vector< unsigned char > seat;
+    arq_t *arq = nullptr;
+    bool ok;
+};
+
+// poll 'from' and hand its frame, if any, to 'to'. returns the frame length.
+unsigned Pump(arq_t *from, arq_t *to, arq_time_t dt, std::vector< unsigned char > const *send, unsigned *send_ofs,
+              unsigned seg_len)
+{
+    arq_event_t event;
+    arq_time_t next_poll;
+    arq_bool_t send_pending, recv_pending;
+    arq_backend_poll(from, dt, &event, &send_pending, &recv_pending, &next_poll);
+    if (send && (*send_ofs < send->size())) { // before releasing a frame, which requires another poll
+        unsigned sent = 0;
+        arq_send(from, send->data() + *send_ofs, seg_len, &sent);
+        *send_ofs += sent;
+    }
+    if (!send_pending) {
+        return 0;
+    }
+    void const *p;
+    unsigned size, filled;
+    arq_backend_send_ptr_get(from, &p, &size);
+    arq_backend_recv_fill(to, p, size, &filled);
+    arq_backend_send_ptr_release(from);
+    return size;
+}
+
+bool Transfer(arq_cfg_t const &cfg, unsigned samples, Wire *out)
+{
+    Peer sender(cfg), receiver(cfg);
+    if (!sender.ok || !receiver.ok) {
+        return false;
+    }
+    std::vector< unsigned char > data(cfg.segment_length_in_bytes * samples);
+    for (auto i = 0u; i < data.size(); ++i) {
+        data[i] = (unsigned char)(i * 13);
+    }
+    unsigned offset = 0;
+    for (auto i = 0u; (i < samples * 8) && (out->payload < data.size()); ++i) {
+        out->data_bytes += Pump(sender.arq, receiver.arq, 1, &data, &offset, cfg.segment_length_in_bytes);
+        out->ack_bytes += Pump(receiver.arq, sender.arq, 1, nullptr, nullptr, 0);
+        unsigned char buf[256];
+        unsigned recvd;
+        do {
+            recvd = 0;
+            arq_recv(receiver.arq, buf, sizeof(buf), &recvd);
+            out->payload += recvd;
+        } while (recvd);
+    }
+    return out->payload == data.size();
+}
+
+}
+
+int main()
+{
+    unsigned const samples = 10000;
+    struct { char const *name; arq_bool_t compact_header, compact_acks; } const layouts[] = {
+        { "full", ARQ_FALSE, ARQ_FALSE },
+        { "compact_header", ARQ_TRUE, ARQ_FALSE },
+        { "compact_header+acks", ARQ_TRUE, ARQ_TRUE },
+    };
+
+    std::printf("frame efficiency, %u x 16-byte telemetry samples, payload bytes per wire byte\n", samples);
+    std::printf("%20s %12s %12s %12s %12s\n", "layout", "payload", "data bytes", "ack bytes", "efficiency");
+    for (auto const &l : layouts) {
+        Wire w;
+        if (!Transfer(MakeCfg(l.compact_header, l.compact_acks), samples, &w)) {
+            return 1;
+        }
+        std::printf("%20s %12lu %12lu %12lu %12.3f\n", l.name, w.payload, w.data_bytes, w.ack_bytes,
+                    (double)w.payload / (double)(w.data_bytes + w.ack_bytes));
+    }
+    return 0;
+}
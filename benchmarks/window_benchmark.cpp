@@ -0,0 +1,113 @@
+#include "arq_in_benchmarks.h"
+#include "benchmark.h"
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+volatile unsigned g_sink;
+
+// Small segments keep the copies short, so the window index arithmetic dominates each call.
+arq_cfg_t MakeCfg()
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 8;
+    cfg.message_length_in_segments = 2;
+    cfg.send_window_size_in_messages = 32;
+    cfg.recv_window_size_in_messages = 32;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.tinygram_send_delay = 10;
+    cfg.inter_segment_timeout = 10;
+    cfg.keepalive_period = 1000;
+    cfg.disconnect_timeout = 5000;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    return cfg;
+}
+
+}
+
+int main()
+{
+    arq_cfg_t const cfg = MakeCfg();
+    unsigned seat_size;
+    if (arq_required_size(&cfg, &seat_size) != ARQ_OK_COMPLETED) {
+        return 1;
+    }
+    std::vector< unsigned char > seat(seat_size);
+    arq_t *arq;
+    if (arq_init(&cfg, seat.data(), seat_size, &arq) != ARQ_OK_COMPLETED) {
+        return 1;
+    }
+    arq__send_wnd_t *const sw = &arq->send_wnd;
+    arq__recv_wnd_t *const rw = &arq->recv_wnd;
+    unsigned const msg_len = cfg.segment_length_in_bytes * cfg.message_length_in_segments;
+    std::vector< arq_uchar_t > data(msg_len, 0x5A), out(msg_len);
+
+    // one message in, one message acked: the window walks the whole sequence space
+    double const send_ack = arq_bench::TicksPerCall([&](unsigned) {
+        unsigned const seq = sw->w.seq;
+        arq__send_wnd_send(sw, data.data(), msg_len, cfg.tinygram_send_delay);
+        arq__send_wnd_ack(sw, seq, sw->w.full_ack_vec);
+    });
+
+    unsigned recv_seq = 0;
+    double const frame_recv = arq_bench::TicksPerCall([&](unsigned) {
+        for (auto seg = 0u; seg < cfg.message_length_in_segments; ++seg) {
+            arq__recv_wnd_frame(rw,
+                                recv_seq,
+                                seg,
+                                cfg.message_length_in_segments,
+                                data.data(),
+                                cfg.segment_length_in_bytes,
+                                cfg.inter_segment_timeout);
+        }
+        recv_seq = (recv_seq + 1) % (ARQ__FRAME_MAX_SEQ_NUM + 1);
+        g_sink = arq__recv_wnd_recv(rw, out.data(), msg_len);
+    });
+
+    // a full window of unacked messages, every one with a running retransmission timer
+    arq__send_wnd_rst(sw);
+    sw->w.seq = 7;
+    for (auto i = 0u; i < cfg.send_window_size_in_messages; ++i) {
+        arq__send_wnd_send(sw, data.data(), msg_len, cfg.tinygram_send_delay);
+    }
+    for (auto i = 0u; i < cfg.send_window_size_in_messages; ++i) {
+        arq__send_wnd_tmr_set(sw, arq__wnd_idx(&sw->w, sw->w.seq + i), 1 + i);
+    }
+    double const next_poll = arq_bench::TicksPerCall([&](unsigned) {
+        g_sink = arq__next_poll(sw, rw, &arq->conn);
+    });
+
+    // no timer expires, so step only has to look at the earliest deadline
+    double const step = arq_bench::TicksPerCall([&](unsigned) {
+        arq__send_wnd_step(sw, 0);
+    });
+
+    // only the newest message is due, so the pointer has to find it past every waiting one
+    arq__send_wnd_tmr_clr(sw, arq__wnd_idx(&sw->w, sw->w.seq + sw->w.size - 1));
+    arq__send_wnd_ptr_t ptr;
+    double const ptr_next = arq_bench::TicksPerCall([&](unsigned) {
+        arq__send_wnd_ptr_rst(&ptr);
+        g_sink = arq__send_wnd_ptr_next(&ptr, sw);
+    });
+
+    std::printf("windows, %u x %u-byte messages, ARQ_POW2_WINDOWS=%d, %s per call\n",
+                cfg.send_window_size_in_messages, msg_len, ARQ_POW2_WINDOWS, arq_bench::TickUnit());
+    std::printf("%12s %12s %12s %12s %12s\n", "send+ack", "frame+recv", "next_poll", "step", "ptr_next");
+    std::printf("%12.1f %12.1f %12.1f %12.1f %12.1f\n",
+                send_ack, frame_recv, next_poll, step, ptr_next);
+    return 0;
+}
@@ -11,8 +11,19 @@ TEST(functional, ack_full_window)
     cfg.send_window_size_in_messages = 16;
     cfg.recv_window_size_in_messages = 16;
     cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
     cfg.inter_segment_timeout = 100;
     cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
     cfg.connection_rst_period = 100;
     cfg.connection_rst_attempts = 10;
 
@@ -71,12 +82,18 @@ TEST(functional, ack_full_window)
         }
     }
 
-    for (auto i = 0u; i < cfg.send_window_size_in_messages; ++i) {
+    // the first message's ACK was queued before the rest arrived, one SACK frame covers the rest
+    auto ack_frames = 0u;
+    for (;;) {
         // drain the receiver's ACK-only frame
         {
             void const *p;
             arq_err_t e = arq_backend_send_ptr_get(receiver.arq, &p, &frame_len);
             CHECK(ARQ_SUCCEEDED(e));
+            if (frame_len == 0) {
+                break;
+            }
+            ++ack_frames;
             std::memcpy(frame.data(), p, frame_len);
             e = arq_backend_send_ptr_release(receiver.arq);
             CHECK(ARQ_SUCCEEDED(e));
@@ -101,6 +118,8 @@ TEST(functional, ack_full_window)
         }
     }
 
+    CHECK_EQUAL(2, ack_frames);
+
     // drain the receiver's receive window
     {
         std::array< arq_uchar_t, 128 > data;
@@ -0,0 +1,110 @@
+#include "functional_tests.h"
+
+namespace {
+
+struct Result
+{
+    unsigned ack_frames = 0;
+    unsigned ack_bytes = 0;
+    std::vector< unsigned char > recvd;
+};
+
+// the sender sends one message at a time and the receiver acks each one.
+Result Transfer(arq_bool_t compact_acks, std::vector< unsigned char > const &send_test_data)
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(64, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 8;
+    cfg.recv_window_size_in_messages = 8;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = compact_acks;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    ArqContext sender(cfg), receiver(cfg);
+
+    Result res;
+    unsigned offset = 0;
+    for (auto i = 0u; (i < 1000) && (res.recvd.size() < send_test_data.size()); ++i) {
+        for (auto side = 0; side < 2; ++side) {
+            arq_t *const from = side ? receiver.arq : sender.arq;
+            arq_t *const to = side ? sender.arq : receiver.arq;
+            arq_event_t event;
+            arq_time_t next_poll;
+            arq_bool_t send_pending, recv_pending;
+            arq_err_t e = arq_backend_poll(from, side ? 0 : cfg.tinygram_send_delay, &event, &send_pending,
+                                           &recv_pending, &next_poll);
+            CHECK(ARQ_SUCCEEDED(e));
+            if (!side && (offset < send_test_data.size())) { // before releasing a frame, which requires another poll
+                unsigned sent;
+                e = arq_send(sender.arq, send_test_data.data() + offset, cfg.segment_length_in_bytes, &sent);
+                CHECK(ARQ_SUCCEEDED(e));
+                offset += sent;
+            }
+            if (side) {
+                unsigned char buf[256];
+                unsigned recvd;
+                e = arq_recv(receiver.arq, buf, sizeof(buf), &recvd);
+                CHECK(ARQ_SUCCEEDED(e));
+                res.recvd.insert(res.recvd.end(), buf, buf + recvd);
+            }
+            if (!send_pending) {
+                continue;
+            }
+            void const *p;
+            unsigned size;
+            e = arq_backend_send_ptr_get(from, &p, &size);
+            CHECK(ARQ_SUCCEEDED(e));
+            if (side) {
+                ++res.ack_frames;
+                res.ack_bytes += size;
+            }
+            unsigned filled;
+            e = arq_backend_recv_fill(to, p, size, &filled);
+            CHECK(ARQ_SUCCEEDED(e));
+            CHECK_EQUAL(size, filled);
+            e = arq_backend_send_ptr_release(from);
+            CHECK(ARQ_SUCCEEDED(e));
+        }
+    }
+    return res;
+}
+
+TEST(functional, compact_acks_halve_ack_bandwidth)
+{
+    std::vector< unsigned char > send_test_data(46 * 32);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (unsigned char)(i * 3);
+    }
+
+    Result const full = Transfer(ARQ_FALSE, send_test_data);
+    Result const compact = Transfer(ARQ_TRUE, send_test_data);
+
+    CHECK_EQUAL(send_test_data.size(), full.recvd.size());
+    CHECK_EQUAL(send_test_data.size(), compact.recvd.size());
+    MEMCMP_EQUAL(send_test_data.data(), compact.recvd.data(), send_test_data.size());
+    CHECK(compact.ack_frames > 0);
+    CHECK_EQUAL(full.ack_frames, compact.ack_frames);
+    CHECK_EQUAL(full.ack_frames * arq__frame_len(0), full.ack_bytes);
+    CHECK_EQUAL(compact.ack_frames * ARQ__FRAME_COMPACT_LEN, compact.ack_bytes);
+    CHECK_EQUAL(full.ack_bytes, compact.ack_bytes * 2);
+}
+
+}
+
@@ -0,0 +1,125 @@
+#include "functional_tests.h"
+#include <deque>
+
+namespace {
+
+TEST(functional, congestion_window_limits_burst)
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(128, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 16;
+    cfg.recv_window_size_in_messages = 16;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = &arq_congestion_aimd;
+    cfg.congestion_user = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    ArqContext sender(cfg), receiver(cfg);
+
+    std::vector< unsigned char > send_test_data(cfg.segment_length_in_bytes * cfg.send_window_size_in_messages);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (unsigned char)(i * 7);
+    }
+    {
+        unsigned sent;
+        arq_err_t const e = arq_send(sender.arq, send_test_data.data(), send_test_data.size(), &sent);
+        CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+        CHECK_EQUAL(send_test_data.size(), sent);
+    }
+
+    // with no acks yet, only the initial congestion window goes out
+    std::vector< std::vector< unsigned char > > in_flight;
+    for (;;) {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t e = arq_backend_poll(sender.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        if (!send_pending) {
+            break;
+        }
+        void const *p;
+        unsigned size;
+        e = arq_backend_send_ptr_get(sender.arq, &p, &size);
+        CHECK(ARQ_SUCCEEDED(e));
+        in_flight.emplace_back((unsigned char const *)p, (unsigned char const *)p + size);
+        e = arq_backend_send_ptr_release(sender.arq);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    CHECK_EQUAL(2u, in_flight.size());
+    {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(sender.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(2u, stats.congestion_window);
+    }
+
+    // every ack opens the window further until the whole transfer is through
+    std::deque< std::vector< unsigned char > > to_receiver(in_flight.begin(), in_flight.end()), to_sender;
+    std::vector< unsigned char > recv_test_data;
+    auto step = [&](arq_t *arq, std::deque< std::vector< unsigned char > > &in,
+                    std::deque< std::vector< unsigned char > > &out, bool drain) {
+        if (!in.empty()) {
+            unsigned filled;
+            arq_err_t const e = arq_backend_recv_fill(arq, in.front().data(), in.front().size(), &filled);
+            CHECK(ARQ_SUCCEEDED(e));
+            CHECK_EQUAL(in.front().size(), filled);
+            in.pop_front();
+        }
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t e = arq_backend_poll(arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        if (drain) { // before releasing a frame, which requires another poll
+            unsigned char buf[256];
+            unsigned recvd;
+            e = arq_recv(arq, buf, sizeof(buf), &recvd);
+            CHECK(ARQ_SUCCEEDED(e));
+            recv_test_data.insert(recv_test_data.end(), buf, buf + recvd);
+        }
+        if (send_pending) {
+            void const *p;
+            unsigned size;
+            e = arq_backend_send_ptr_get(arq, &p, &size);
+            CHECK(ARQ_SUCCEEDED(e));
+            out.emplace_back((unsigned char const *)p, (unsigned char const *)p + size);
+            e = arq_backend_send_ptr_release(arq);
+            CHECK(ARQ_SUCCEEDED(e));
+        }
+    };
+    for (auto i = 0u; (i < 1000) && (recv_test_data.size() < send_test_data.size()); ++i) {
+        step(receiver.arq, to_receiver, to_sender, true);
+        step(sender.arq, to_sender, to_receiver, false);
+    }
+
+    {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(sender.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK(stats.congestion_window > 2u);
+        CHECK_EQUAL(0, stats.retransmitted_frames_sent);
+    }
+    CHECK_EQUAL(send_test_data.size(), recv_test_data.size());
+    MEMCMP_EQUAL(send_test_data.data(), recv_test_data.data(), send_test_data.size());
+}
+
+}
+
@@ -10,8 +10,19 @@ TEST(functional, connect_times_out_after_n_attempts)
     cfg.send_window_size_in_messages = 16;
     cfg.recv_window_size_in_messages = 16;
     cfg.retransmission_timeout = 1000;
+    cfg.retransmission_timeout_max = 10000;
     cfg.tinygram_send_delay = cfg.segment_length_in_bytes;
     cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
     cfg.connection_rst_attempts = 10;
     cfg.connection_rst_period = 100;
     ArqContext ctx(cfg);
@@ -0,0 +1,145 @@
+#include "functional_tests.h"
+#include <deque>
+#include <functional>
+
+namespace {
+
+struct Result
+{
+    unsigned ack_only_frames;
+    int ack_frames_saved;
+};
+
+struct Peer
+{
+    explicit Peer(arq_cfg_t const &cfg) : ctx(cfg) {}
+    ArqContext ctx;
+    std::deque< std::vector< unsigned char > > in;
+    std::vector< unsigned char > recvd;
+};
+
+// A sends a request, B answers it after thinking for a while, A sends the next request as soon as the
+// answer arrives. Returns how many ACK-only frames went over the wire in either direction.
+Result RequestResponse(arq_time_t ack_delay)
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(128, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 8;
+    cfg.recv_window_size_in_messages = 8;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = ack_delay;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    Peer a(cfg), b(cfg);
+
+    arq_time_t const think_time = 10;
+    unsigned const rounds = 8;
+    std::vector< unsigned char > msg(cfg.segment_length_in_bytes);
+    auto send = [&](Peer &p, unsigned char fill) {
+        std::fill(msg.begin(), msg.end(), fill);
+        unsigned sent;
+        arq_err_t const e = arq_send(p.ctx.arq, msg.data(), msg.size(), &sent);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(msg.size(), sent);
+    };
+
+    Result r{ 0, 0 };
+    // the application runs between the poll and releasing the frame, which would require another poll
+    auto step = [&](Peer &p, Peer &peer, std::function< void() > const &app) {
+        if (!p.in.empty()) {
+            unsigned filled;
+            arq_err_t const e = arq_backend_recv_fill(p.ctx.arq, p.in.front().data(), p.in.front().size(), &filled);
+            CHECK(ARQ_SUCCEEDED(e));
+            p.in.pop_front();
+        }
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t e = arq_backend_poll(p.ctx.arq, 1, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        {
+            unsigned char buf[256];
+            unsigned n;
+            e = arq_recv(p.ctx.arq, buf, sizeof(buf), &n);
+            CHECK(ARQ_SUCCEEDED(e));
+            p.recvd.insert(p.recvd.end(), buf, buf + n);
+        }
+        app();
+        if (!send_pending) {
+            return;
+        }
+        void const *f;
+        unsigned size;
+        e = arq_backend_send_ptr_get(p.ctx.arq, &f, &size);
+        CHECK(ARQ_SUCCEEDED(e));
+        peer.in.emplace_back((unsigned char const *)f, (unsigned char const *)f + size);
+        e = arq_backend_send_ptr_release(p.ctx.arq);
+        CHECK(ARQ_SUCCEEDED(e));
+        std::vector< unsigned char > decoded(peer.in.back()); // arq__frame_read decodes in place
+        arq__frame_hdr_t h;
+        void const *seg;
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(decoded.data(), size, cfg.checksum, &h, &seg));
+        r.ack_only_frames += (h.ack && !h.seg) ? 1u : 0u;
+    };
+
+    unsigned requests = 1, answers = 0;
+    arq_time_t answer_at = ARQ_TIME_INFINITY;
+    send(a, 0);
+    for (arq_time_t now = 0; now < 2000; ++now) {
+        step(a, b, [&]() {
+            if ((requests < rounds) && (a.recvd.size() == requests * msg.size())) {
+                send(a, (unsigned char)requests++);
+            }
+        });
+        step(b, a, [&]() {
+            if ((answer_at == ARQ_TIME_INFINITY) && (b.recvd.size() == (answers + 1) * msg.size())) {
+                answer_at = now + think_time;
+            }
+            if (now == answer_at) {
+                send(b, (unsigned char)answers++);
+                answer_at = ARQ_TIME_INFINITY;
+            }
+        });
+    }
+
+    CHECK_EQUAL(rounds * msg.size(), a.recvd.size());
+    CHECK_EQUAL(rounds * msg.size(), b.recvd.size());
+    for (Peer *p : { &a, &b }) {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(p->ctx.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(0, stats.retransmitted_frames_sent);
+        r.ack_frames_saved += stats.ack_frames_saved;
+    }
+    return r;
+}
+
+TEST(functional, delayed_acks_ride_on_reverse_traffic)
+{
+    Result const immediate = RequestResponse(0);
+    Result const delayed = RequestResponse(50);
+    CHECK_EQUAL(0, immediate.ack_frames_saved);
+    CHECK_EQUAL(16u, immediate.ack_only_frames); // every request and every answer gets its own ACK
+    CHECK(delayed.ack_frames_saved > 0);
+    CHECK(delayed.ack_only_frames <= 1u); // only the last answer's ACK has nothing to ride on
+}
+
+}
+
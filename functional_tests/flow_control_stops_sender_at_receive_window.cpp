@@ -0,0 +1,144 @@
+#include "functional_tests.h"
+
+namespace {
+
+struct Link
+{
+    arq_cfg_t const &cfg;
+    std::array< unsigned char, 256 > frame;
+    std::array< unsigned char, 256 > decoded;
+    arq__frame_hdr_t h;
+};
+
+// poll 'from' once and hand its frame to 'to' unless 'drop' is set. returns true if a frame was sent.
+bool Pump(Link &l, arq_t *from, arq_t *to, arq_time_t dt, bool drop, arq_time_t *next_poll)
+{
+    arq_event_t event;
+    arq_bool_t send_pending, recv_pending;
+    arq_err_t e = arq_backend_poll(from, dt, &event, &send_pending, &recv_pending, next_poll);
+    CHECK(ARQ_SUCCEEDED(e));
+    if (!send_pending) {
+        return false;
+    }
+    void const *p;
+    unsigned size;
+    e = arq_backend_send_ptr_get(from, &p, &size);
+    CHECK(ARQ_SUCCEEDED(e));
+    std::memcpy(l.frame.data(), p, size);
+    e = arq_backend_send_ptr_release(from);
+    CHECK(ARQ_SUCCEEDED(e));
+    std::memcpy(l.decoded.data(), l.frame.data(), size); // arq__frame_read decodes in place
+    void const *seg;
+    arq__frame_read_result_t const r = arq__frame_read(l.decoded.data(), size, l.cfg.checksum, &l.h, &seg);
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
+    if (!drop) {
+        unsigned filled;
+        e = arq_backend_recv_fill(to, l.frame.data(), size, &filled);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(size, filled);
+    }
+    return true;
+}
+
+TEST(functional, flow_control_stops_sender_at_receive_window)
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(128, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 8;
+    cfg.recv_window_size_in_messages = 2;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    ArqContext sender(cfg), receiver(cfg);
+    Link l{ cfg, {}, {}, {} };
+
+    std::vector< unsigned char > send_test_data(cfg.segment_length_in_bytes * cfg.send_window_size_in_messages);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (unsigned char)i;
+    }
+    {
+        unsigned sent;
+        arq_err_t const e = arq_send(sender.arq, send_test_data.data(), send_test_data.size(), &sent);
+        CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+        CHECK_EQUAL(send_test_data.size(), sent);
+    }
+
+    unsigned data_frames = 0;
+    arq_time_t sender_next_poll = 0;
+    auto exchange = [&]() {
+        for (;;) {
+            arq_time_t np;
+            bool const s = Pump(l, sender.arq, receiver.arq, 0, false, &sender_next_poll);
+            data_frames += (s && l.h.seg) ? 1u : 0u;
+            bool const r = Pump(l, receiver.arq, sender.arq, 0, false, &np);
+            if (!s && !r) {
+                break;
+            }
+        }
+    };
+
+    std::vector< unsigned char > recv_test_data;
+    auto drain = [&]() {
+        unsigned char buf[256];
+        unsigned recvd;
+        do {
+            arq_err_t const e = arq_recv(receiver.arq, buf, sizeof(buf), &recvd);
+            CHECK(ARQ_SUCCEEDED(e));
+            recv_test_data.insert(recv_test_data.end(), buf, buf + recvd);
+        } while (recvd);
+    };
+
+    // the sender stops once the receive window is full
+    exchange();
+    CHECK_EQUAL(cfg.recv_window_size_in_messages, data_frames);
+    CHECK(sender_next_poll > 0);
+    CHECK(sender_next_poll <= cfg.retransmission_timeout_max);
+
+    // draining the receiver produces a window update; lose it
+    drain();
+    CHECK_EQUAL(cfg.recv_window_size_in_messages * cfg.segment_length_in_bytes, recv_test_data.size());
+    {
+        arq_time_t np;
+        CHECK(Pump(l, receiver.arq, sender.arq, 0, true, &np));
+        CHECK(l.h.win && !l.h.seg);
+        CHECK_EQUAL(cfg.recv_window_size_in_messages, l.h.win_size);
+        CHECK(!Pump(l, receiver.arq, sender.arq, 0, false, &np));
+    }
+
+    // the sender's zero-window probe lets one message out and the ack reopens the window
+    CHECK(Pump(l, sender.arq, receiver.arq, sender_next_poll, false, &sender_next_poll));
+    CHECK(l.h.seg);
+    ++data_frames;
+    exchange();
+    CHECK_EQUAL(cfg.recv_window_size_in_messages * 2, data_frames);
+
+    while (recv_test_data.size() < send_test_data.size()) {
+        drain();
+        exchange();
+    }
+
+    CHECK_EQUAL(cfg.send_window_size_in_messages, data_frames);
+    CHECK_EQUAL(send_test_data.size(), recv_test_data.size());
+    MEMCMP_EQUAL(send_test_data.data(), recv_test_data.data(), send_test_data.size());
+}
+
+}
+
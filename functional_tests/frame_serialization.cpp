@@ -1,4 +1,5 @@
 #include "functional_tests.h"
+#include <cstring>
 
 namespace {
 
@@ -26,5 +27,36 @@ TEST(functional, frame_serialization)
     }
 }
 
+TEST(functional, frame_serialization_crc32c)
+{
+    arq_uchar_t seg[256];
+    arq_uchar_t frame[256];
+
+    for (auto i = 0u; i < sizeof(seg); ++i) {
+        seg[i] = (arq_uchar_t)(255 - i);
+    }
+
+    for (auto i = 0; i < 239; ++i) {
+        arq__frame_hdr_t write_hdr;
+        arq__frame_hdr_init(&write_hdr);
+        write_hdr.version = arq__frame_version(arq_crc32c);
+        write_hdr.seg_len = i;
+        auto const frame_len = arq__frame_write(&write_hdr, seg, arq_crc32c, frame, sizeof(frame));
+
+        arq_uchar_t copy[256];
+        std::memcpy(copy, frame, frame_len);
+
+        arq__frame_hdr_t read_hdr;
+        void const *read_seg;
+        auto const r = arq__frame_read(frame, frame_len, arq_crc32c, &read_hdr, &read_seg);
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
+        CHECK_EQUAL(write_hdr.seg_len, read_hdr.seg_len);
+        MEMCMP_EQUAL(seg, read_seg, read_hdr.seg_len);
+
+        auto const mismatch = arq__frame_read(copy, frame_len, arq_crc32, &read_hdr, &read_seg);
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_VERSION, mismatch);
+    }
+}
+
 }
 
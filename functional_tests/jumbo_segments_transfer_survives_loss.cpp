@@ -0,0 +1,85 @@
+#include "functional_tests.h"
+
+namespace {
+
+TEST(functional, jumbo_segments_transfer_survives_loss)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 4096;
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 8;
+    cfg.recv_window_size_in_messages = 8;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 20;
+    cfg.tinygram_send_delay = 10;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_TRUE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    ArqContext sender(cfg), receiver(cfg);
+
+    // the first half has no zero bytes, which would send a single-block segment in place
+    std::vector< unsigned char > send_test_data(cfg.segment_length_in_bytes * 64);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (i < send_test_data.size() / 2) ? (unsigned char)((i % 255) + 1) : (unsigned char)(i * 13);
+    }
+
+    std::vector< unsigned char > recv_test_data;
+    unsigned offset = 0, frames = 0, longest = 0;
+    for (auto i = 0u; (i < 10000) && (recv_test_data.size() < send_test_data.size()); ++i) {
+        for (auto side = 0; side < 2; ++side) {
+            arq_t *const from = side ? receiver.arq : sender.arq;
+            arq_t *const to = side ? sender.arq : receiver.arq;
+            arq_event_t event;
+            arq_time_t next_poll;
+            arq_bool_t send_pending, recv_pending;
+            arq_err_t e = arq_backend_poll(from, 5, &event, &send_pending, &recv_pending, &next_poll);
+            CHECK(ARQ_SUCCEEDED(e));
+            if (!side && (offset < send_test_data.size())) { // before releasing a frame, which requires another poll
+                unsigned sent;
+                e = arq_send(sender.arq, send_test_data.data() + offset, send_test_data.size() - offset, &sent);
+                CHECK(ARQ_SUCCEEDED(e));
+                offset += sent;
+            }
+            if (side) {
+                std::vector< unsigned char > buf(cfg.segment_length_in_bytes);
+                unsigned recvd;
+                e = arq_recv(receiver.arq, buf.data(), (unsigned)buf.size(), &recvd);
+                CHECK(ARQ_SUCCEEDED(e));
+                recv_test_data.insert(recv_test_data.end(), buf.begin(), buf.begin() + recvd);
+            }
+            if (!send_pending) {
+                continue;
+            }
+            void const *p;
+            unsigned size;
+            e = arq_backend_send_ptr_get(from, &p, &size);
+            CHECK(ARQ_SUCCEEDED(e));
+            longest = std::max(longest, size);
+            if (side || ((++frames % 7) != 0)) { // lose every seventh data frame
+                unsigned filled;
+                e = arq_backend_recv_fill(to, p, size, &filled);
+                CHECK(ARQ_SUCCEEDED(e));
+                CHECK_EQUAL(size, filled);
+            }
+            e = arq_backend_send_ptr_release(from);
+            CHECK(ARQ_SUCCEEDED(e));
+        }
+    }
+
+    CHECK_EQUAL(arq__frame_len(cfg.segment_length_in_bytes), longest);
+    CHECK_EQUAL(send_test_data.size(), recv_test_data.size());
+    MEMCMP_EQUAL(send_test_data.data(), recv_test_data.data(), send_test_data.size());
+}
+
+}
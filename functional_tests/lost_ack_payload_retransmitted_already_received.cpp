@@ -11,8 +11,19 @@ TEST(functional, lost_ack_payload_retransmitted_already_received)
     cfg.send_window_size_in_messages = 1;
     cfg.recv_window_size_in_messages = 1;
     cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
     cfg.inter_segment_timeout = 100;
     cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
     cfg.connection_rst_attempts = 10;
     cfg.connection_rst_period = 100;
 
@@ -80,8 +91,6 @@ TEST(functional, lost_ack_payload_retransmitted_already_received)
         std::memcpy(frame.data(), p, frame_len);
         e = arq_backend_send_ptr_release(receiver.arq);
         CHECK(ARQ_SUCCEEDED(e));
-        e = arq_backend_poll(receiver.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
-        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
         arq__frame_hdr_t h;
         void const *seg;
         arq__frame_read_result_t const r = arq__frame_read(frame.data(), frame_len, cfg.checksum, &h, &seg);
@@ -93,6 +102,30 @@ TEST(functional, lost_ack_payload_retransmitted_already_received)
         CHECK_EQUAL(1, h.cur_ack_vec);
     }
 
+    // lose the window update sent after arq_recv freed the message
+    {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t e = arq_backend_poll(receiver.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && send_pending);
+        void const *p;
+        e = arq_backend_send_ptr_get(receiver.arq, &p, &frame_len);
+        CHECK(ARQ_SUCCEEDED(e));
+        std::memcpy(frame.data(), p, frame_len);
+        e = arq_backend_send_ptr_release(receiver.arq);
+        CHECK(ARQ_SUCCEEDED(e));
+        e = arq_backend_poll(receiver.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
+        arq__frame_hdr_t h;
+        void const *seg;
+        arq__frame_read_result_t const r = arq__frame_read(frame.data(), frame_len, cfg.checksum, &h, &seg);
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
+        CHECK(!h.ack && !h.seg && h.win);
+        CHECK_EQUAL(1, h.ack_num);
+        CHECK_EQUAL(1, h.win_size);
+    }
+
     // poll the sender with a large dt to retransmit the message
     {
         arq_event_t event;
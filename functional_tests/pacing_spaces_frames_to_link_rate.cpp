@@ -0,0 +1,77 @@
+#include "functional_tests.h"
+
+namespace {
+
+TEST(functional, pacing_spaces_frames_to_link_rate)
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(128, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 8;
+    cfg.recv_window_size_in_messages = 8;
+    cfg.retransmission_timeout = 1000;
+    cfg.retransmission_timeout_max = 10000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 8;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 12800; // one 128-byte frame every 10ms
+    cfg.pacing_burst_in_bytes = 128;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    ArqContext sender(cfg);
+
+    std::vector< unsigned char > send_test_data(cfg.segment_length_in_bytes * cfg.send_window_size_in_messages);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (unsigned char)i;
+    }
+    {
+        unsigned sent;
+        arq_err_t const e = arq_send(sender.arq, send_test_data.data(), send_test_data.size(), &sent);
+        CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+        CHECK_EQUAL(send_test_data.size(), sent);
+    }
+
+    // a full burst lets exactly one frame out even though the send ring could hold the whole window
+    arq_time_t elapsed = 0, dt = 0;
+    unsigned frames = 0;
+    while (frames < cfg.send_window_size_in_messages) {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t e = arq_backend_poll(sender.arq, dt, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        elapsed += dt;
+        if (send_pending) {
+            void const *p;
+            unsigned size;
+            e = arq_backend_send_ptr_get(sender.arq, &p, &size);
+            CHECK(ARQ_SUCCEEDED(e));
+            CHECK(size <= cfg.pacing_burst_in_bytes);
+            e = arq_backend_send_ptr_release(sender.arq);
+            CHECK(ARQ_SUCCEEDED(e));
+            ++frames;
+            dt = 0;
+        } else {
+            // the bucket is the only thing holding the sender back, so it says when to come back
+            CHECK(next_poll > 0);
+            CHECK(next_poll <= 10);
+            dt = next_poll;
+        }
+    }
+    CHECK(elapsed > (cfg.send_window_size_in_messages - 2) * 10);
+    CHECK(elapsed <= (cfg.send_window_size_in_messages - 1) * 10);
+}
+
+}
+
@@ -0,0 +1,87 @@
+#include "functional_tests.h"
+
+namespace {
+
+TEST(functional, recv_burst_in_one_fill)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 128;
+    cfg.message_length_in_segments = 4;
+    cfg.send_window_size_in_messages = 16;
+    cfg.recv_window_size_in_messages = 16;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 8;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+
+    ArqContext ctx(cfg);
+
+    std::vector< arq_uchar_t > test_input, test_output;
+
+    test_input.resize(cfg.recv_window_size_in_messages *
+                      cfg.message_length_in_segments *
+                      cfg.segment_length_in_bytes);
+    for (auto i = 0u; i < test_input.size() / 2; ++i) {
+        arq_uint16_t x = (arq_uint16_t)i;
+        std::memcpy(&test_input[i * 2], &x, sizeof(x));
+    }
+
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.msg_len = cfg.message_length_in_segments;
+
+    // serialize the whole window back-to-back, the way a dma burst would deliver it
+    std::vector< arq_uchar_t > burst;
+    unsigned frame_count = 0;
+    for (size_t ofs = 0; ofs < test_input.size(); ofs += cfg.segment_length_in_bytes) {
+        h.seg = 1;
+        h.seg_len = cfg.segment_length_in_bytes;
+        std::vector< arq_uchar_t > frame(arq__frame_len(h.seg_len));
+        unsigned const frame_len = arq__frame_write(&h, &test_input[ofs], arq_crc32, frame.data(), frame.size());
+        burst.insert(burst.end(), frame.data(), frame.data() + frame_len);
+        h.seq_num += (h.seg_id == cfg.message_length_in_segments - 1);
+        h.seg_id = (h.seg_id + 1) % cfg.message_length_in_segments;
+        ++frame_count;
+    }
+
+    // each fill takes a full ring of frames, each poll drains it
+    size_t burst_offset = 0;
+    unsigned fills = 0;
+    while (burst_offset < burst.size()) {
+        unsigned recvd;
+        arq_err_t e = arq_backend_recv_fill(ctx.arq, &burst[burst_offset], burst.size() - burst_offset, &recvd);
+        CHECK_EQUAL(ARQ_OK_POLL_REQUIRED, e);
+        CHECK_EQUAL(arq__frame_len(cfg.segment_length_in_bytes) * cfg.recv_ring_size_in_frames, recvd);
+        burst_offset += recvd;
+        ++fills;
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t s, r;
+        e = arq_backend_poll(ctx.arq, 0, &event, &s, &r, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK(r);
+        CHECK_EQUAL(0u, arq__recv_ring_pending(&ctx.arq->recv_ring));
+    }
+    CHECK_EQUAL(frame_count / cfg.recv_ring_size_in_frames, fills);
+
+    test_output.resize(test_input.size());
+    unsigned recvd;
+    arq_err_t const e = arq_recv(ctx.arq, test_output.data(), test_output.size(), &recvd);
+    CHECK(ARQ_SUCCEEDED(e));
+    CHECK_EQUAL(test_output.size(), recvd);
+    MEMCMP_EQUAL(test_input.data(), test_output.data(), test_input.size());
+}
+
+}
+
@@ -10,7 +10,18 @@ TEST(functional, recv_full_window_one_byte_at_a_time)
     cfg.send_window_size_in_messages = 16;
     cfg.recv_window_size_in_messages = 16;
     cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
     cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
     cfg.connection_rst_attempts = 10;
     cfg.connection_rst_period = 100;
 
@@ -27,6 +38,7 @@ TEST(functional, recv_full_window_one_byte_at_a_time)
     }
 
     arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
     h.msg_len = cfg.message_length_in_segments;
     h.seg_id = 0;
     h.seq_num = 0;
@@ -0,0 +1,149 @@
+#include "functional_tests.h"
+
+namespace {
+
+arq_cfg_t MakeCfg()
+{
+    arq_cfg_t cfg;
+    {
+        arq_err_t const e = arq_seg_len_from_frame_len(128, &cfg.segment_length_in_bytes);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+    cfg.message_length_in_segments = 1;
+    cfg.send_window_size_in_messages = 16;
+    cfg.recv_window_size_in_messages = 16;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.inter_segment_timeout = 100;
+    cfg.tinygram_send_delay = 50;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 10;
+    return cfg;
+}
+
+// sends message 0 and drains its frame
+void SendOne(arq_t *arq, arq_cfg_t const &cfg)
+{
+    std::vector< arq_uchar_t > send_test_data(cfg.segment_length_in_bytes);
+    {
+        unsigned sent;
+        arq_err_t const e = arq_send(arq, send_test_data.data(), send_test_data.size(), &sent);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(send_test_data.size(), sent);
+    }
+
+    // drain message 0
+    {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        void const *p;
+        unsigned size;
+        arq_err_t e = arq_backend_poll(arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && send_pending);
+        e = arq_backend_send_ptr_get(arq, &p, &size);
+        CHECK(ARQ_SUCCEEDED(e));
+        e = arq_backend_send_ptr_release(arq);
+        CHECK(ARQ_SUCCEEDED(e));
+        e = arq_backend_poll(arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
+        CHECK_EQUAL(cfg.retransmission_timeout, next_poll);
+    }
+}
+
+void FillAck(arq_t *arq)
+{
+    arq_uchar_t frame[256];
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.ack = ARQ_TRUE;
+    h.ack_num = 0;
+    h.cur_ack_vec = 1;
+    unsigned const len = arq__frame_write(&h, nullptr, &arq_crc32, frame, sizeof(frame));
+    unsigned recvd;
+    arq_err_t e = arq_backend_recv_fill(arq, frame, len, &recvd);
+    CHECK(ARQ_SUCCEEDED(e));
+    CHECK_EQUAL(len, recvd);
+}
+
+TEST(functional, retransmission_timeout_adapts_to_rtt)
+{
+    arq_cfg_t const cfg = MakeCfg();
+    ArqContext ctx(cfg);
+
+    {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(ctx.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(cfg.retransmission_timeout, stats.retransmission_timeout);
+        CHECK_EQUAL(0, stats.smoothed_rtt);
+    }
+
+    SendOne(ctx.arq, cfg);
+
+    // let 40ms of round-trip time elapse
+    {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t const e = arq_backend_poll(ctx.arq, 40, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
+    }
+
+    // ack message 0
+    {
+        FillAck(ctx.arq);
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t const e = arq_backend_poll(ctx.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
+    }
+
+    // srtt = 40, rttvar = 20, rto = srtt + 4 * rttvar
+    {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(ctx.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(40, stats.smoothed_rtt);
+        CHECK_EQUAL(120, stats.retransmission_timeout);
+    }
+}
+
+TEST(functional, retransmission_timeout_counts_time_of_poll_that_delivers_ack)
+{
+    arq_cfg_t const cfg = MakeCfg();
+    ArqContext ctx(cfg);
+    SendOne(ctx.arq, cfg);
+
+    // the ack arrives 40ms later and is handled by the poll that accounts for those 40ms
+    {
+        FillAck(ctx.arq);
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t send_pending, recv_pending;
+        arq_err_t const e = arq_backend_poll(ctx.arq, 40, &event, &send_pending, &recv_pending, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e) && !send_pending);
+    }
+
+    {
+        arq_stats_t stats;
+        arq_err_t const e = arq_stats_get(ctx.arq, &stats);
+        CHECK(ARQ_SUCCEEDED(e));
+        CHECK_EQUAL(40, stats.smoothed_rtt);
+        CHECK_EQUAL(120, stats.retransmission_timeout);
+    }
+}
+
+}
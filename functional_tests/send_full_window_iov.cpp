@@ -0,0 +1,93 @@
+#include "functional_tests.h"
+
+namespace {
+
+TEST(functional, send_full_window_iov)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 220;
+    cfg.message_length_in_segments = 4;
+    cfg.send_window_size_in_messages = 16;
+    cfg.recv_window_size_in_messages = 16;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_TRUE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+    ArqContext ctx(cfg);
+
+    // mostly zero-free payload with the occasional zero, so both frame layouts get exercised
+    std::vector< arq_uchar_t > send_test_data(cfg.send_window_size_in_messages *
+                                              cfg.message_length_in_segments *
+                                              cfg.segment_length_in_bytes);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (i % 1000 == 999) ? 0 : (arq_uchar_t)(1 + (i % 251));
+    }
+
+    std::vector< arq_uchar_t > recv_test_data;
+    recv_test_data.reserve(send_test_data.size());
+
+    {
+        unsigned sent;
+        arq_err_t const e = arq_send(ctx.arq, send_test_data.data(), send_test_data.size(), &sent);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+
+    unsigned scattered = 0, contiguous = 0;
+    while (recv_test_data.size() < send_test_data.size()) {
+        {
+            arq_event_t event;
+            arq_time_t next_poll;
+            arq_bool_t send_pending, recv_pending;
+            arq_err_t e = arq_backend_poll(ctx.arq, 0, &event, &send_pending, &recv_pending, &next_poll);
+            CHECK(ARQ_SUCCEEDED(e));
+            CHECK(send_pending);
+        }
+
+        // gather the vectors the way writev() would
+        std::vector< arq_uchar_t > frame;
+        {
+            arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+            unsigned iov_count;
+            arq_err_t e = arq_backend_send_iov_get(ctx.arq, iov, &iov_count);
+            CHECK(ARQ_SUCCEEDED(e));
+            CHECK(iov_count > 0);
+            for (auto i = 0u; i < iov_count; ++i) {
+                frame.insert(frame.end(),
+                             (arq_uchar_t const *)iov[i].base,
+                             (arq_uchar_t const *)iov[i].base + iov[i].len);
+            }
+            scattered += (iov_count == ARQ_SEND_IOV_MAX);
+            contiguous += (iov_count == 1);
+            e = arq_backend_send_ptr_release(ctx.arq);
+            CHECK(ARQ_SUCCEEDED(e));
+        }
+
+        {
+            void const *seg;
+            arq__frame_hdr_t h;
+            arq__frame_read_result_t const r = arq__frame_read(frame.data(), frame.size(), cfg.checksum, &h, &seg);
+            CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
+            recv_test_data.insert(std::end(recv_test_data),
+                                  (arq_uchar_t const *)seg,
+                                  (arq_uchar_t const *)seg + h.seg_len);
+        }
+    }
+    CHECK(scattered > 0);
+    CHECK(contiguous > 0);
+    CHECK_EQUAL(send_test_data.size(), recv_test_data.size());
+    MEMCMP_EQUAL(send_test_data.data(), recv_test_data.data(), send_test_data.size());
+}
+
+}
+
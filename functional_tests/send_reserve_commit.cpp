@@ -0,0 +1,162 @@
+#include "functional_tests.h"
+#include <map>
+
+namespace {
+
+typedef std::map< unsigned, std::vector< arq_uchar_t > > Segments;
+
+void DrainSegments(arq_t *arq, arq_cfg_t const &cfg, Segments &out)
+{
+    for (;;) {
+        arq_event_t event;
+        arq_time_t next_poll;
+        arq_bool_t s, r;
+        arq_err_t e = arq_backend_poll(arq, 0, &event, &s, &r, &next_poll);
+        CHECK(ARQ_SUCCEEDED(e));
+        if (!s) {
+            break;
+        }
+        void const *p;
+        unsigned size;
+        e = arq_backend_send_ptr_get(arq, &p, &size);
+        CHECK(ARQ_SUCCEEDED(e));
+        arq_uchar_t frame[256];
+        std::memcpy(frame, p, size);
+        arq__frame_hdr_t h;
+        void const *seg;
+        arq__frame_read_result_t const rr = arq__frame_read(frame, size, cfg.checksum, &h, &seg);
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, rr);
+        // acks can trigger retransmission of in-flight messages, key segments by position in the stream
+        out[(h.seq_num * cfg.message_length_in_segments) + h.seg_id]
+            .assign((arq_uchar_t const *)seg, (arq_uchar_t const *)seg + h.seg_len);
+        e = arq_backend_send_ptr_release(arq);
+        CHECK(ARQ_SUCCEEDED(e));
+    }
+}
+
+void AckMessage(arq_t *arq, arq_cfg_t const &cfg, unsigned seq)
+{
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.ack = ARQ_TRUE;
+    h.ack_num = seq;
+    h.cur_ack_vec = (arq_uint16_t)((1u << cfg.message_length_in_segments) - 1);
+    arq_uchar_t frame[32];
+    unsigned const frame_len = arq__frame_write(&h, nullptr, cfg.checksum, frame, sizeof(frame));
+    unsigned filled;
+    arq_err_t const e = arq_backend_recv_fill(arq, frame, frame_len, &filled);
+    CHECK(ARQ_SUCCEEDED(e));
+    CHECK_EQUAL(frame_len, filled);
+}
+
+TEST(functional, send_reserve_commit_writes_in_place_across_wrap)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 64;
+    cfg.message_length_in_segments = 2;
+    cfg.send_window_size_in_messages = 4;
+    cfg.recv_window_size_in_messages = 4;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.tinygram_send_delay = 10;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+    ArqContext ctx(cfg);
+
+    unsigned const msg_bytes = cfg.message_length_in_segments * cfg.segment_length_in_bytes;
+    std::vector< arq_uchar_t > send_test_data(msg_bytes * 6);
+    for (auto i = 0u; i < send_test_data.size(); ++i) {
+        send_test_data[i] = (arq_uchar_t)(i * 7);
+    }
+    Segments segs;
+
+    void *p;
+    unsigned span;
+    arq_err_t e = arq_send_reserve(ctx.arq, &p, &span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(msg_bytes * cfg.send_window_size_in_messages, span);
+    std::memcpy(p, send_test_data.data(), msg_bytes * 3);
+    e = arq_send_commit(ctx.arq, msg_bytes * 3);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    DrainSegments(ctx.arq, cfg, segs);
+    CHECK_EQUAL(cfg.message_length_in_segments * 3, segs.size());
+
+    // retire the first two messages, the free space now wraps around the end of the window
+    AckMessage(ctx.arq, cfg, 0);
+    DrainSegments(ctx.arq, cfg, segs);
+    AckMessage(ctx.arq, cfg, 1);
+    DrainSegments(ctx.arq, cfg, segs);
+
+    e = arq_send_reserve(ctx.arq, &p, &span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(msg_bytes, span);
+    std::memcpy(p, &send_test_data[msg_bytes * 3], span);
+    e = arq_send_commit(ctx.arq, span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+
+    e = arq_send_reserve(ctx.arq, &p, &span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(msg_bytes * 2, span);
+    std::memcpy(p, &send_test_data[msg_bytes * 4], span);
+    e = arq_send_commit(ctx.arq, span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+
+    e = arq_send_reserve(ctx.arq, &p, &span);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(0u, span);
+
+    DrainSegments(ctx.arq, cfg, segs);
+    std::vector< arq_uchar_t > recv_test_data;
+    for (auto const &seg : segs) {
+        recv_test_data.insert(recv_test_data.end(), seg.second.begin(), seg.second.end());
+    }
+    CHECK_EQUAL(send_test_data.size(), recv_test_data.size());
+    MEMCMP_EQUAL(send_test_data.data(), recv_test_data.data(), send_test_data.size());
+}
+
+TEST(functional, send_commit_more_than_reserved_fails)
+{
+    arq_cfg_t cfg;
+    cfg.segment_length_in_bytes = 64;
+    cfg.message_length_in_segments = 2;
+    cfg.send_window_size_in_messages = 4;
+    cfg.recv_window_size_in_messages = 4;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.tinygram_send_delay = 10;
+    cfg.checksum = &arq_crc32;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 1;
+    cfg.send_ring_size_in_frames = 1;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    cfg.connection_rst_attempts = 10;
+    cfg.connection_rst_period = 100;
+    ArqContext ctx(cfg);
+
+    void *p;
+    unsigned span;
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_send_reserve(ctx.arq, &p, &span));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(ctx.arq, span + 1));
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_send_commit(ctx.arq, span));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(ctx.arq, 1));
+}
+
+}
+
@@ -3,6 +3,8 @@
 #define ARQ_USE_C_STDLIB 1
 #define ARQ_LITTLE_ENDIAN_CPU 1
 #define ARQ_COMPILE_CRC32 1
+#define ARQ_CRC32_SLICING_BY 16
+#define ARQ_COMPILE_CRC32C 1
 #define ARQ_USE_CONNECTIONS 1
 
 #include "arq_enable_mocks.h"
@@ -13,27 +13,44 @@
     ARQ_MOCK(arq__wnd_seg) \
     ARQ_MOCK(arq__send_wnd_rst) \
     ARQ_MOCK(arq__send_wnd_send) \
+    ARQ_MOCK(arq__send_wnd_reserve) \
+    ARQ_MOCK(arq__send_wnd_commit) \
     ARQ_MOCK(arq__send_wnd_ack) \
+    ARQ_MOCK(arq__send_wnd_sack) \
+    ARQ_MOCK(arq__send_wnd_rwnd) \
     ARQ_MOCK(arq__send_wnd_flush) \
     ARQ_MOCK(arq__send_wnd_step) \
     ARQ_MOCK(arq__send_wnd_ptr_rst) \
     ARQ_MOCK(arq__send_wnd_ptr_next) \
     ARQ_MOCK(arq__send_frame_init) \
     ARQ_MOCK(arq__send_frame_rst) \
+    ARQ_MOCK(arq__send_frame_flatten) \
     ARQ_MOCK(arq__send_poll) \
     ARQ_MOCK(arq__recv_wnd_rst) \
     ARQ_MOCK(arq__recv_wnd_frame) \
     ARQ_MOCK(arq__recv_wnd_ack) \
+    ARQ_MOCK(arq__recv_wnd_sack) \
+    ARQ_MOCK(arq__recv_wnd_adv) \
     ARQ_MOCK(arq__recv_wnd_pending) \
+    ARQ_MOCK(arq__recv_wnd_seq) \
     ARQ_MOCK(arq__recv_wnd_recv) \
+    ARQ_MOCK(arq__recv_wnd_peek) \
+    ARQ_MOCK(arq__recv_wnd_consume) \
     ARQ_MOCK(arq__recv_frame_init) \
     ARQ_MOCK(arq__recv_frame_fill) \
     ARQ_MOCK(arq__recv_frame_rst) \
+    ARQ_MOCK(arq__recv_ring_init) \
+    ARQ_MOCK(arq__recv_ring_rst) \
+    ARQ_MOCK(arq__recv_ring_fill) \
+    ARQ_MOCK(arq__recv_ring_pending) \
+    ARQ_MOCK(arq__recv_ring_pop) \
+    ARQ_MOCK(arq__pacer_rst) \
     ARQ_MOCK(arq__recv_poll) \
     ARQ_MOCK(arq__conn_poll) \
     ARQ_MOCK(arq__conn_poll_state_cb_get) \
     ARQ_MOCK(arq__conn_next_poll) \
     ARQ_MOCK(arq__frame_len) \
+    ARQ_MOCK(arq__frame_version) \
     ARQ_MOCK(arq__frame_hdr_init) \
     ARQ_MOCK(arq__frame_hdr_read) \
     ARQ_MOCK(arq__frame_hdr_write) \
@@ -42,8 +59,16 @@
     ARQ_MOCK(arq__frame_read) \
     ARQ_MOCK(arq__frame_checksum_read) \
     ARQ_MOCK(arq__frame_write) \
+    ARQ_MOCK(arq__frame_write_fused) \
+    ARQ_MOCK(arq__frame_write_iov) \
+    ARQ_MOCK(arq__frame_compact_write) \
+    ARQ_MOCK(arq__frame_compact_read) \
+    ARQ_MOCK(arq__frame_var_hdr_write) \
+    ARQ_MOCK(arq__frame_var_hdr_read) \
+    ARQ_MOCK(arq__find_zero) \
     ARQ_MOCK(arq__cobs_encode) \
     ARQ_MOCK(arq__cobs_decode) \
+    ARQ_MOCK(arq__cobs_decode_checksum) \
     ARQ_MOCK(arq__hton32) \
     ARQ_MOCK(arq__ntoh32)
 
@@ -2,6 +2,8 @@
 #include "arq_runtime_mock_plugin.h"
 #include <CppUTest/TestHarness.h>
 #include <CppUTestExt/MockSupport.h>
+#include <vector>
+#include <cstring>
 
 TEST_GROUP(poll) {};
 
@@ -13,8 +15,7 @@ arq_bool_t MockSendPoll(arq__send_wnd_t *sw,
                         arq__send_wnd_ptr_t *p,
                         arq__frame_hdr_t *sh,
                         arq__frame_hdr_t *rh,
-                        arq_time_t dt,
-                        arq_time_t rtx)
+                        arq_time_t dt)
 {
     if (sh) {
         sh->seq_num = SequenceNumber;
@@ -27,7 +28,6 @@ arq_bool_t MockSendPoll(arq__send_wnd_t *sw,
                                                           .withParameter("sh", sh)
                                                           .withParameter("rh", rh)
                                                           .withParameter("dt", dt)
-                                                          .withParameter("rtx", rtx)
                                                           .returnUnsignedIntValue();
 }
 
@@ -89,6 +89,12 @@ void MockWndSeg(arq__wnd_t *w, unsigned seq, unsigned seg, void **out_seg, int *
                                      .withOutputParameter("out_seg_len", out_seg_len);
 }
 
+unsigned MockFrameVersion(arq_checksum_t checksum)
+{
+    return mock().actualCall("arq__frame_version").withParameter("checksum", (void *)checksum)
+                                                  .returnUnsignedIntValue();
+}
+
 arq_time_t MockNextPoll(arq__send_wnd_t *sw, arq__recv_wnd_t *rw)
 {
     return (arq_time_t)mock().actualCall("arq__next_poll").withParameter("sw", sw)
@@ -108,9 +114,29 @@ struct Fixture
         ARQ_MOCK_HOOK(arq__next_poll, MockNextPoll);
         ARQ_MOCK_HOOK(arq__conn_poll, MockConnPoll);
         arq.cfg.checksum = &arq_crc32;
+        arq.cfg.segment_length_in_bytes = 64;
+        arq.cfg.send_iov = ARQ_FALSE;
+        arq.cfg.compact_acks = ARQ_FALSE;
+        arq.cfg.compact_header = ARQ_FALSE;
+        arq.pacer.rate = 0;
+        arq.pacer.cap = 0;
+        arq.pacer.tokens = 0;
+        arq.pacer.scale = 0;
+        arq.recv_wnd.ack_delay_on = ARQ_FALSE;
+        arq.conn.state = ARQ_CONN_STATE_ESTABLISHED;
         arq__send_frame_init(&arq.send_frame, 100);
+        arq__send_frame_rst(&arq.send_frame);
+        arq.send_frame.buf = send_buf;
+        arq.recv_ring.frame = recv_frames;
+        arq.recv_ring.cap = 4;
+        arq.recv_ring.rd = arq.recv_ring.wr = 0;
+        for (auto &rf : recv_frames) {
+            rf.state = ARQ__RECV_FRAME_STATE_ACCUMULATING;
+        }
     }
     arq_t arq;
+    arq__recv_frame_t recv_frames[4];
+    arq_uchar_t send_buf[400];
     arq_bool_t send_ready = ARQ_FALSE;
     arq_bool_t recv_ready = ARQ_FALSE;
     arq_event_t event;
@@ -157,10 +183,10 @@ TEST(poll, only_initializes_headers_if_unable_to_emit_frame_because_user_holding
     arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
 }
 
-TEST(poll, only_initializes_headers_if_unable_to_emit_frame_because_frame_is_not_empty)
+TEST(poll, only_initializes_headers_if_unable_to_emit_frame_because_send_ring_is_full)
 {
     DefaultMocksFixture f;
-    f.arq.send_frame.len = 10;
+    f.arq.send_frame.len = f.arq.send_frame.cap - arq__frame_len(f.arq.cfg.segment_length_in_bytes) + 1;
     mock().expectOneCall("arq__frame_hdr_init").ignoreOtherParameters();
     mock().expectOneCall("arq__frame_hdr_init").ignoreOtherParameters();
     mock().ignoreOtherCalls();
@@ -172,7 +198,7 @@ TEST(poll, calls_recv_poll_with_arq_context)
     DefaultMocksFixture f;
     f.arq.cfg.checksum = (arq_checksum_t)0x12345678;
     mock().expectOneCall("arq__recv_poll").withParameter("rw", &f.arq.recv_wnd)
-                                          .withParameter("f", &f.arq.recv_frame)
+                                          .withParameter("f", &f.arq.recv_ring.frame[0])
                                           .withParameter("checksum", (void *)f.arq.cfg.checksum)
                                           .withParameter("dt", f.time)
                                           .ignoreOtherParameters();
@@ -189,25 +215,168 @@ TEST(poll, calls_recv_poll_with_null_send_header_if_unable_to_emit_frame_because
     arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
 }
 
-TEST(poll, calls_recv_poll_with_null_send_header_if_unable_to_emit_frame_because_frame_is_not_empty)
+TEST(poll, calls_recv_poll_with_null_send_header_if_unable_to_emit_frame_because_send_ring_is_full)
 {
     DefaultMocksFixture f;
-    f.arq.send_frame.len = 1;
+    f.arq.send_frame.len = f.arq.send_frame.cap - arq__frame_len(f.arq.cfg.segment_length_in_bytes) + 1;
     mock().expectOneCall("arq__recv_poll").withParameter("sh", (void *)NULL).ignoreOtherParameters();
     mock().ignoreOtherCalls();
     arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
 }
 
+TEST(poll, calls_recv_poll_once_per_pending_frame_in_ring_order)
+{
+    DefaultMocksFixture f;
+    f.arq.recv_ring.rd = 3;
+    f.recv_frames[3].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    mock().expectOneCall("arq__recv_poll").withParameter("f", &f.recv_frames[3]).ignoreOtherParameters();
+    mock().expectOneCall("arq__recv_poll").withParameter("f", &f.recv_frames[0]).ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(1u, f.arq.recv_ring.rd);
+}
+
+TEST(poll, only_first_pending_frame_sees_elapsed_time)
+{
+    DefaultMocksFixture f;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[1].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[2].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    for (arq_time_t const dt : { 55, 0, 0 }) {
+        mock().expectOneCall("arq__recv_poll").withParameter("dt", dt).ignoreOtherParameters();
+        mock().expectOneCall("arq__send_poll").withParameter("dt", dt).ignoreOtherParameters();
+        mock().expectOneCall("arq__conn_poll").withParameter("dt", dt).ignoreOtherParameters();
+    }
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 55, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
+namespace {
+arq_bool_t ConnPollClosing(arq__conn_t *conn,
+                           arq__frame_hdr_t *sh,
+                           arq__frame_hdr_t const *,
+                           arq_time_t,
+                           arq_cfg_t const *,
+                           arq_event_t *out_event)
+{
+    mock().actualCall("arq__conn_poll").withParameter("has_sh", sh != nullptr);
+    conn->state = ARQ_CONN_STATE_CLOSED;
+    *out_event = ARQ_EVENT_CONN_RESET_BY_PEER;
+    return ARQ_FALSE;
+}
+
+arq_bool_t ConnPollDesyncWhileClosed(arq__conn_t *,
+                                     arq__frame_hdr_t *sh,
+                                     arq__frame_hdr_t const *,
+                                     arq_time_t,
+                                     arq_cfg_t const *,
+                                     arq_event_t *out_event)
+{
+    mock().actualCall("arq__conn_poll").withParameter("has_sh", sh != nullptr);
+    *out_event = ARQ_EVENT_CONN_FAILED_DESYNC;
+    return ARQ_FALSE;
+}
+}
+
+TEST(poll, stops_draining_ring_at_first_event_that_changes_connection_state)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__conn_poll);
+    ARQ_MOCK_HOOK(arq__conn_poll, ConnPollClosing);
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[1].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[2].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    mock().expectOneCall("arq__recv_poll").ignoreOtherParameters();
+    mock().expectOneCall("arq__conn_poll").withParameter("has_sh", false);
+    mock().expectNoCall("arq__frame_write");
+    mock().expectNoCall("arq__next_poll");
+    mock().ignoreOtherCalls();
+    f.time = 1234;
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(ARQ_EVENT_CONN_RESET_BY_PEER, f.event);
+    CHECK_EQUAL(1u, f.arq.recv_ring.rd);
+    CHECK_EQUAL(0, f.time);
+}
+
+TEST(poll, reports_event_from_last_pending_frame_and_builds_send_header)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__conn_poll);
+    ARQ_MOCK_HOOK(arq__conn_poll, ConnPollClosing);
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    mock().expectOneCall("arq__conn_poll").withParameter("has_sh", true);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(ARQ_EVENT_CONN_RESET_BY_PEER, f.event);
+    CHECK_EQUAL(1u, f.arq.recv_ring.rd);
+}
+
+TEST(poll, keeps_draining_ring_through_events_that_leave_connection_state_alone)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__conn_poll);
+    ARQ_MOCK_HOOK(arq__conn_poll, ConnPollDesyncWhileClosed);
+    f.arq.conn.state = ARQ_CONN_STATE_CLOSED;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[1].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    mock().expectNCalls(2, "arq__conn_poll").ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(ARQ_EVENT_CONN_FAILED_DESYNC, f.event);
+    CHECK_EQUAL(2u, f.arq.recv_ring.rd);
+}
+
+TEST(poll, only_last_pending_frame_builds_send_header)
+{
+    struct Local
+    {
+        static arq_bool_t RecvPoll(arq__recv_wnd_t *,
+                                   arq__recv_frame_t *,
+                                   arq_checksum_t,
+                                   arq__frame_hdr_t *sh,
+                                   arq__frame_hdr_t *,
+                                   arq_time_t)
+        {
+            return (arq_bool_t)mock().actualCall("arq__recv_poll").withParameter("has_sh", sh != nullptr)
+                                                                  .returnUnsignedIntValue();
+        }
+    };
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, Local::RecvPoll);
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    f.recv_frames[0].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.recv_frames[1].state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    mock().expectOneCall("arq__recv_poll").withParameter("has_sh", false);
+    mock().expectOneCall("arq__recv_poll").withParameter("has_sh", true);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(2u, f.arq.recv_ring.rd);
+}
+
+TEST(poll, doesnt_advance_ring_if_no_frame_is_pending)
+{
+    DefaultMocksFixture f;
+    mock().expectOneCall("arq__recv_poll").withParameter("f", &f.recv_frames[0]).ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(0u, f.arq.recv_ring.rd);
+}
+
 TEST(poll, calls_send_poll_with_arq_context)
 {
     DefaultMocksFixture f;
-    f.arq.cfg.retransmission_timeout = 7654;
     int const dt = 1234;
     mock().expectOneCall("arq__send_poll").withParameter("sw", &f.arq.send_wnd)
                                           .withParameter("f", &f.arq.send_frame)
                                           .withParameter("p", &f.arq.send_wnd_ptr)
                                           .withParameter("dt", dt)
-                                          .withParameter("rtx", f.arq.cfg.retransmission_timeout)
                                           .ignoreOtherParameters();
     mock().ignoreOtherCalls();
     arq_backend_poll(&f.arq, dt, &f.event, &f.send_ready, &f.recv_ready, &f.time);
@@ -292,6 +461,105 @@ TEST(poll, doesnt_load_segment_from_send_window_if_header_segment_flag_isnt_set)
     arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
 }
 
+TEST(poll, writes_sack_block_from_recv_window_as_payload_if_header_carries_one)
+{
+    DefaultMocksFixture f;
+    arq_uchar_t sack[8];
+    f.arq.recv_wnd.sack = sack;
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    struct Local
+    {
+        static arq_bool_t RecvPoll(arq__recv_wnd_t *rw,
+                                   arq__recv_frame_t *,
+                                   arq_checksum_t,
+                                   arq__frame_hdr_t *sh,
+                                   arq__frame_hdr_t *,
+                                   arq_time_t)
+        {
+            if (sh) {
+                sh->ack = ARQ_TRUE;
+                sh->sack = rw->sack;
+                sh->seg_len = 5;
+            }
+            return (arq_bool_t)mock().actualCall("arq__recv_poll").returnIntValue();
+        }
+    };
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, Local::RecvPoll);
+    mock().expectOneCall("arq__recv_poll").andReturnValue(1);
+    mock().expectNoCall("arq__wnd_seg");
+    mock().expectOneCall("arq__frame_write").withParameter("seg", (void const *)sack)
+                                            .ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
+unsigned MockFrameCompactWrite(arq__frame_hdr_t const *h, arq_checksum_t checksum, void *out_frame, unsigned frame_max)
+{
+    return mock().actualCall("arq__frame_compact_write").withParameter("h", h)
+                                                        .withParameter("checksum", (void *)checksum)
+                                                        .withParameter("out_frame", out_frame)
+                                                        .withParameter("frame_max", frame_max)
+                                                        .returnUnsignedIntValue();
+}
+
+TEST(poll, compact_acks_writes_frame_without_payload_in_short_form)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_HOOK(arq__frame_compact_write, MockFrameCompactWrite);
+    f.arq.cfg.compact_acks = ARQ_TRUE;
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    mock().expectOneCall("arq__recv_poll").ignoreOtherParameters().andReturnValue(1);
+    mock().expectNoCall("arq__frame_write");
+    mock().expectOneCall("arq__frame_compact_write").withParameter("checksum", (void *)f.arq.cfg.checksum)
+                                                    .withParameter("out_frame", (void *)f.arq.send_frame.buf)
+                                                    .withParameter("frame_max", f.arq.send_frame.cap)
+                                                    .ignoreOtherParameters()
+                                                    .andReturnValue(ARQ__FRAME_COMPACT_LEN);
+    mock().expectOneCall("arq__recv_poll").ignoreOtherParameters().andReturnValue(0);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(ARQ__FRAME_COMPACT_LEN, f.arq.send_frame.len);
+}
+
+TEST(poll, compact_acks_writes_sack_block_in_full_frame)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_HOOK(arq__frame_compact_write, MockFrameCompactWrite);
+    arq_uchar_t sack[8];
+    f.arq.cfg.compact_acks = ARQ_TRUE;
+    f.arq.recv_wnd.sack = sack;
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    struct Local
+    {
+        static arq_bool_t RecvPoll(arq__recv_wnd_t *rw,
+                                   arq__recv_frame_t *,
+                                   arq_checksum_t,
+                                   arq__frame_hdr_t *sh,
+                                   arq__frame_hdr_t *,
+                                   arq_time_t)
+        {
+            if (sh) {
+                sh->ack = ARQ_TRUE;
+                sh->sack = rw->sack;
+                sh->seg_len = 5;
+            }
+            return (arq_bool_t)mock().actualCall("arq__recv_poll").returnIntValue();
+        }
+    };
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, Local::RecvPoll);
+    mock().expectOneCall("arq__recv_poll").andReturnValue(1);
+    mock().expectNoCall("arq__frame_compact_write");
+    mock().expectOneCall("arq__frame_write").withParameter("seg", (void const *)sack)
+                                            .ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
 TEST(poll, emits_a_frame_if_send_poll_returns_one_and_send_frame_available)
 {
     DefaultMocksFixture f;
@@ -331,6 +599,269 @@ TEST(poll, frame_write_return_value_becomes_send_frame_length)
     CHECK_EQUAL(543, f.arq.send_frame.len);
 }
 
+struct BatchFixture : Fixture
+{
+    static int send_polls_left;
+    static std::vector< unsigned > frame_offsets;
+    static std::vector< arq_time_t > send_poll_dts;
+    static arq_uchar_t const *frame_base;
+
+    static arq_bool_t SendPoll(arq__send_wnd_t *,
+                               arq__send_frame_t *,
+                               arq__send_wnd_ptr_t *,
+                               arq__frame_hdr_t *sh,
+                               arq__frame_hdr_t *,
+                               arq_time_t dt,
+                               arq_time_t)
+    {
+        send_poll_dts.push_back(dt);
+        if (!sh || (send_polls_left == 0)) {
+            return ARQ_FALSE;
+        }
+        --send_polls_left;
+        return ARQ_TRUE;
+    }
+
+    static unsigned FrameWrite(arq__frame_hdr_t const *, void const *, arq_checksum_t, void *out, unsigned)
+    {
+        frame_offsets.push_back((unsigned)((arq_uchar_t const *)out - frame_base));
+        return arq__frame_len(64);
+    }
+
+    BatchFixture()
+    {
+        ARQ_MOCK_UNHOOK(arq__frame_hdr_init);
+        ARQ_MOCK_HOOK(arq__send_poll, SendPoll);
+        ARQ_MOCK_UNHOOK(arq__frame_write);
+        ARQ_MOCK_HOOK(arq__frame_write, FrameWrite);
+        arq__send_frame_init(&arq.send_frame, sizeof(send_buf));
+        send_polls_left = 0;
+        frame_offsets.clear();
+        send_poll_dts.clear();
+        frame_base = send_buf;
+        mock().ignoreOtherCalls();
+    }
+};
+
+int BatchFixture::send_polls_left;
+std::vector< unsigned > BatchFixture::frame_offsets;
+std::vector< arq_time_t > BatchFixture::send_poll_dts;
+arq_uchar_t const *BatchFixture::frame_base;
+
+TEST(poll, appends_frames_back_to_back_until_send_ring_is_full)
+{
+    BatchFixture f;
+    f.send_polls_left = 100;
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    unsigned const frame_len = arq__frame_len(64);
+    unsigned const frames = sizeof(f.send_buf) / frame_len;
+    CHECK_EQUAL(frames, f.frame_offsets.size());
+    for (auto i = 0u; i < frames; ++i) {
+        CHECK_EQUAL(i * frame_len, f.frame_offsets[i]);
+    }
+    CHECK_EQUAL(frames * frame_len, f.arq.send_frame.len);
+    CHECK(f.send_ready);
+}
+
+TEST(poll, stops_appending_frames_when_nothing_is_left_to_emit)
+{
+    BatchFixture f;
+    f.send_polls_left = 2;
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(2u, f.frame_offsets.size());
+}
+
+TEST(poll, only_first_appended_frame_sees_elapsed_time)
+{
+    BatchFixture f;
+    f.send_polls_left = 3;
+    arq_backend_poll(&f.arq, 77, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(4u, f.send_poll_dts.size());
+    CHECK_EQUAL(77u, f.send_poll_dts[0]);
+    CHECK_EQUAL(0u, f.send_poll_dts[1]);
+    CHECK_EQUAL(0u, f.send_poll_dts[2]);
+    CHECK_EQUAL(0u, f.send_poll_dts[3]);
+}
+
+TEST(poll, appends_after_unsent_frames_already_in_send_ring)
+{
+    BatchFixture f;
+    f.send_polls_left = 1;
+    f.arq.send_frame.len = 17;
+    f.arq.send_frame.ofs = 5;
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(1u, f.frame_offsets.size());
+    CHECK_EQUAL(17u, f.frame_offsets[0]);
+}
+
+TEST(poll, pacing_stops_appending_frames_at_burst_size)
+{
+    BatchFixture f;
+    unsigned const frame_len = arq__frame_len(64);
+    f.send_polls_left = 100;
+    f.arq.pacer.rate = 1000;
+    f.arq.pacer.scale = 1000;
+    f.arq.pacer.cap = f.arq.pacer.tokens = 2 * frame_len * 1000;
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(2u, f.frame_offsets.size());
+    CHECK_EQUAL(0u, f.arq.pacer.tokens);
+}
+
+TEST(poll, pacing_holds_frames_back_and_reports_when_next_may_go)
+{
+    BatchFixture f;
+    unsigned const frame_len = arq__frame_len(64);
+    f.send_polls_left = 100;
+    f.arq.pacer.rate = 1000;
+    f.arq.pacer.scale = 1000;
+    f.arq.pacer.cap = 2 * frame_len * 1000;
+    f.arq.pacer.tokens = 0;
+    mock().expectOneCall("arq__next_poll").ignoreOtherParameters().andReturnValue(ARQ_TIME_INFINITY);
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(0u, f.frame_offsets.size());
+    CHECK_EQUAL(frame_len, f.time);
+}
+
+TEST(poll, pacing_doesnt_delay_earlier_timers)
+{
+    BatchFixture f;
+    f.arq.pacer.rate = 1000;
+    f.arq.pacer.scale = 1000;
+    f.arq.pacer.cap = 2 * arq__frame_len(64) * 1000;
+    f.arq.pacer.tokens = 0;
+    mock().expectOneCall("arq__next_poll").ignoreOtherParameters().andReturnValue(3u);
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(3u, f.time);
+}
+
+TEST(poll, pacing_refills_with_elapsed_time_before_building_frames)
+{
+    BatchFixture f;
+    unsigned const frame_len = arq__frame_len(64);
+    f.send_polls_left = 100;
+    f.arq.pacer.rate = 1000;
+    f.arq.pacer.scale = 1000;
+    f.arq.pacer.cap = 2 * frame_len * 1000;
+    f.arq.pacer.tokens = 0;
+    arq_backend_poll(&f.arq, frame_len, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(1u, f.frame_offsets.size());
+}
+
+struct IovFixture : Fixture
+{
+    static arq_uchar_t seg[8];
+
+    static void WndSeg(arq__wnd_t *, unsigned, unsigned, void **out_seg, int *out_seg_len)
+    {
+        *out_seg = seg;
+        *out_seg_len = (int)sizeof(seg);
+    }
+
+    static unsigned FrameWriteIov(arq__frame_hdr_t const *, void const *s, arq__checksum_update_t, void *out)
+    {
+        mock().actualCall("arq__frame_write_iov").withParameter("seg", s).withParameter("out", out);
+        return arq__frame_len(sizeof(seg));
+    }
+
+    IovFixture()
+    {
+        void *msp = reinterpret_cast< void * >(&MockSendPoll<0, 0, true>);
+        ARQ_MOCK_HOOK(arq__send_poll, msp);
+        ARQ_MOCK_UNHOOK(arq__wnd_seg);
+        ARQ_MOCK_HOOK(arq__wnd_seg, WndSeg);
+        ARQ_MOCK_HOOK(arq__frame_write_iov, FrameWriteIov);
+        arq.cfg.send_iov = ARQ_TRUE;
+        arq__send_frame_init(&arq.send_frame, sizeof(send_buf));
+        std::memset(seg, 0x55, sizeof(seg));
+    }
+};
+
+arq_uchar_t IovFixture::seg[8];
+
+TEST(poll, send_iov_leaves_zero_free_segment_in_send_window)
+{
+    IovFixture f;
+    mock().expectOneCall("arq__send_poll").ignoreOtherParameters().andReturnValue(1);
+    mock().expectOneCall("arq__frame_write_iov").withParameter("seg", (void const *)f.seg)
+                                                .withParameter("out", (void *)f.send_buf);
+    mock().expectNoCall("arq__frame_write");
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL((void const *)f.seg, f.arq.send_frame.seg);
+    CHECK_EQUAL(sizeof(f.seg), f.arq.send_frame.seg_len);
+    CHECK_EQUAL((unsigned)(ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN), f.arq.send_frame.len);
+    CHECK(f.send_ready);
+}
+
+TEST(poll, send_iov_encodes_whole_frame_if_segment_contains_a_zero)
+{
+    IovFixture f;
+    f.seg[3] = 0;
+    mock().expectOneCall("arq__send_poll").ignoreOtherParameters().andReturnValue(1);
+    mock().expectNoCall("arq__frame_write_iov");
+    mock().expectOneCall("arq__frame_write").ignoreOtherParameters().andReturnValue(20);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL((void const *)NULL, f.arq.send_frame.seg);
+    CHECK_EQUAL(20u, f.arq.send_frame.len);
+}
+
+TEST(poll, send_iov_encodes_one_frame_per_poll)
+{
+    IovFixture f;
+    f.arq.send_frame.len = 20;
+    mock().expectNoCall("arq__frame_write_iov");
+    mock().expectNoCall("arq__frame_write");
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
+TEST(poll, stamps_send_header_version_from_configured_checksum)
+{
+    struct Local
+    {
+        static unsigned FrameWrite(arq__frame_hdr_t const *h, void const *, arq_checksum_t, void *, unsigned)
+        {
+            return mock().actualCall("arq__frame_write").withParameter("version", h->version)
+                                                        .returnUnsignedIntValue();
+        }
+    };
+    DefaultMocksFixture f;
+    ARQ_MOCK_HOOK(arq__frame_version, MockFrameVersion);
+    ARQ_MOCK_UNHOOK(arq__frame_write);
+    ARQ_MOCK_HOOK(arq__frame_write, Local::FrameWrite);
+    mock().expectOneCall("arq__frame_version").withParameter("checksum", (void *)f.arq.cfg.checksum)
+                                              .andReturnValue(ARQ__FRAME_VERSION_CHECKSUM_CRC32C);
+    mock().expectOneCall("arq__send_poll").ignoreOtherParameters().andReturnValue(1);
+    mock().expectOneCall("arq__frame_write").withParameter("version", ARQ__FRAME_VERSION_CHECKSUM_CRC32C);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
+TEST(poll, compact_header_sets_var_layout_in_frame_version)
+{
+    struct Local
+    {
+        static unsigned FrameWrite(arq__frame_hdr_t const *h, void const *, arq_checksum_t, void *, unsigned)
+        {
+            return mock().actualCall("arq__frame_write").withParameter("version", h->version)
+                                                        .returnUnsignedIntValue();
+        }
+    };
+    DefaultMocksFixture f;
+    f.arq.cfg.compact_header = ARQ_TRUE;
+    ARQ_MOCK_HOOK(arq__frame_version, MockFrameVersion);
+    ARQ_MOCK_UNHOOK(arq__frame_write);
+    ARQ_MOCK_HOOK(arq__frame_write, Local::FrameWrite);
+    mock().expectOneCall("arq__frame_version").withParameter("checksum", (void *)f.arq.cfg.checksum)
+                                              .andReturnValue(ARQ__FRAME_VERSION_CHECKSUM_CRC32C);
+    mock().expectOneCall("arq__send_poll").ignoreOtherParameters().andReturnValue(1);
+    mock().expectOneCall("arq__frame_write")
+        .withParameter("version", ARQ__FRAME_VERSION_CHECKSUM_CRC32C | ARQ__FRAME_VERSION_LAYOUT_VAR);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+}
+
 TEST(poll, recv_pending_flag_is_result_of_recv_pending_call_true)
 {
     DefaultMocksFixture f;
@@ -361,6 +892,70 @@ TEST(poll, sets_frame_state_to_free_if_emitting_frame)
     CHECK_EQUAL(ARQ__SEND_FRAME_STATE_FREE, f.arq.send_frame.state);
 }
 
+namespace {
+arq_bool_t RecvPollAdvertisingWindow(arq__recv_wnd_t *,
+                                     arq__recv_frame_t *,
+                                     arq_checksum_t,
+                                     arq__frame_hdr_t *sh,
+                                     arq__frame_hdr_t *,
+                                     arq_time_t)
+{
+    if (sh) {
+        sh->win = ARQ_TRUE;
+        sh->ack_num = 3;
+        sh->win_size = 7;
+    }
+    return (arq_bool_t)mock().actualCall("arq__recv_poll").returnUnsignedIntValue();
+}
+}
+
+TEST(poll, remembers_window_advertisement_once_frame_is_written)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, RecvPollAdvertisingWindow);
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    f.arq.recv_wnd.adv = ARQ_TRUE;
+    f.arq.recv_wnd.adv_end = 0;
+    mock().expectOneCall("arq__recv_poll").andReturnValue(1);
+    mock().expectOneCall("arq__frame_write").ignoreOtherParameters().andReturnValue(20u);
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK(!f.arq.recv_wnd.adv);
+    CHECK_EQUAL(3 + 7, f.arq.recv_wnd.adv_end);
+}
+
+TEST(poll, leaves_window_update_pending_if_no_frame_is_written)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, RecvPollAdvertisingWindow);
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_HELD;
+    f.arq.recv_wnd.adv = ARQ_TRUE;
+    f.arq.recv_wnd.adv_end = 0;
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK(f.arq.recv_wnd.adv);
+    CHECK_EQUAL(0, f.arq.recv_wnd.adv_end);
+}
+
+TEST(poll, doesnt_remember_window_advertisement_if_nothing_is_emitted)
+{
+    DefaultMocksFixture f;
+    ARQ_MOCK_UNHOOK(arq__recv_poll);
+    ARQ_MOCK_HOOK(arq__recv_poll, RecvPollAdvertisingWindow);
+    f.arq.send_frame.len = 0;
+    f.arq.send_frame.state = ARQ__SEND_FRAME_STATE_FREE;
+    f.arq.recv_wnd.adv = ARQ_FALSE;
+    f.arq.recv_wnd.adv_end = 0;
+    mock().expectOneCall("arq__recv_poll").andReturnValue(0);
+    mock().expectNoCall("arq__frame_write");
+    mock().ignoreOtherCalls();
+    arq_backend_poll(&f.arq, 0, &f.event, &f.send_ready, &f.recv_ready, &f.time);
+    CHECK_EQUAL(0, f.arq.recv_wnd.adv_end);
+}
+
 TEST(poll, out_next_poll_is_result_of_arq_poll)
 {
     DefaultMocksFixture f;
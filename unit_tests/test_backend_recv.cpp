@@ -17,65 +17,75 @@ TEST(backend_recv, invalid_params)
     CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_recv_fill(&arq,    recv,    recv_size, nullptr));
 }
 
-unsigned MockRecvFrameFill(arq__recv_frame_t *f, void const *src, unsigned len)
+unsigned MockRecvRingFill(arq__recv_ring_t *r, void const *src, unsigned len)
 {
-    return mock().actualCall("arq__recv_frame_fill").withParameter("f", f)
-                                                    .withParameter("src", src)
-                                                    .withParameter("len", len)
-                                                    .returnUnsignedIntValue();
+    return mock().actualCall("arq__recv_ring_fill").withParameter("r", r)
+                                                   .withParameter("src", src)
+                                                   .withParameter("len", len)
+                                                   .returnUnsignedIntValue();
+}
+
+unsigned MockRecvRingPending(arq__recv_ring_t const *r)
+{
+    return mock().actualCall("arq__recv_ring_pending").withParameter("r", r).returnUnsignedIntValue();
 }
 
 struct Fixture
 {
     Fixture()
     {
-        ARQ_MOCK_HOOK(arq__recv_frame_fill, MockRecvFrameFill);
+        ARQ_MOCK_HOOK(arq__recv_ring_fill, MockRecvRingFill);
+        ARQ_MOCK_HOOK(arq__recv_ring_pending, MockRecvRingPending);
+        arq.need_poll = ARQ_FALSE;
     }
     arq_t arq;
     char recv[29];
     unsigned recvd;
 };
 
-TEST(backend_recv, forwards_to_arq_recv_frame_fill)
+TEST(backend_recv, forwards_to_arq_recv_ring_fill)
 {
     Fixture f;
-    mock().expectOneCall("arq__recv_frame_fill").withParameter("f", &f.arq.recv_frame)
-                                                .withParameter("src", (void const *)f.recv)
-                                                .withParameter("len", sizeof(f.recv));
+    mock().expectOneCall("arq__recv_ring_fill").withParameter("r", &f.arq.recv_ring)
+                                               .withParameter("src", (void const *)f.recv)
+                                               .withParameter("len", sizeof(f.recv));
+    mock().ignoreOtherCalls();
     arq_backend_recv_fill(&f.arq, f.recv, sizeof(f.recv), &f.recvd);
 }
 
-TEST(backend_recv, return_value_from_arq_recv_frame_fill_written_to_output_len_param)
+TEST(backend_recv, return_value_from_arq_recv_ring_fill_written_to_output_len_param)
 {
     Fixture f;
-    mock().expectOneCall("arq__recv_frame_fill").ignoreOtherParameters().andReturnValue(123);
+    mock().expectOneCall("arq__recv_ring_fill").ignoreOtherParameters().andReturnValue(123);
+    mock().ignoreOtherCalls();
     arq_backend_recv_fill(&f.arq, f.recv, sizeof(f.recv), &f.recvd);
     CHECK_EQUAL(123, f.recvd);
 }
 
-TEST(backend_recv, returns_ok_success_if_frame_state_is_accumulating)
+TEST(backend_recv, returns_ok_success_if_no_frames_are_pending)
 {
     Fixture f;
+    mock().expectOneCall("arq__recv_ring_pending").withParameter("r", &f.arq.recv_ring).andReturnValue(0u);
     mock().ignoreOtherCalls();
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_ACCUMULATING;
     arq_err_t const rv = arq_backend_recv_fill(&f.arq, f.recv, sizeof(f.recv), &f.recvd);
     CHECK_EQUAL(ARQ_OK_COMPLETED, rv);
+    CHECK_EQUAL(ARQ_FALSE, f.arq.need_poll);
 }
 
-TEST(backend_recv, returns_ok_poll_if_frame_state_is_complete)
+TEST(backend_recv, returns_ok_poll_if_frames_are_pending)
 {
     Fixture f;
+    mock().expectOneCall("arq__recv_ring_pending").withParameter("r", &f.arq.recv_ring).andReturnValue(3u);
     mock().ignoreOtherCalls();
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
     arq_err_t const rv = arq_backend_recv_fill(&f.arq, f.recv, sizeof(f.recv), &f.recvd);
     CHECK_EQUAL(ARQ_OK_POLL_REQUIRED, rv);
 }
 
-TEST(backend_recv, sets_need_poll_to_true_if_frame_state_is_complete)
+TEST(backend_recv, sets_need_poll_to_true_if_frames_are_pending)
 {
     Fixture f;
+    mock().expectOneCall("arq__recv_ring_pending").ignoreOtherParameters().andReturnValue(1u);
     mock().ignoreOtherCalls();
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
     arq_backend_recv_fill(&f.arq, f.recv, sizeof(f.recv), &f.recvd);
     CHECK_EQUAL(ARQ_TRUE, f.arq.need_poll);
 }
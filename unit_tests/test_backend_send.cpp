@@ -21,11 +21,14 @@ struct Fixture
     Fixture()
     {
         arq__send_wnd_ptr_rst(&arq.send_wnd_ptr);
-        arq.send_frame.len = 1234;
-        arq.send_frame.buf = (arq_uchar_t *)0x12345678;
+        arq__send_frame_rst(&arq.send_frame);
+        arq.send_frame.buf = buf;
+        arq.send_frame.cap = sizeof(buf);
+        arq.send_frame.len = 7;
     }
 
     arq_t arq;
+    arq_uchar_t buf[32] = { 1, 2, 0, 3, 4, 5, 0 };
     void const *send = nullptr;
     unsigned size = 0;
 };
@@ -75,12 +78,148 @@ TEST(backend_send, send_ptr_get_sets_buf_to_send_frame_when_valid)
     CHECK_EQUAL((void const *)f.arq.send_frame.buf, f.send);
 }
 
-TEST(backend_send, send_ptr_get_sets_len_to_send_frame_len_when_valid)
+TEST(backend_send, send_ptr_get_sets_len_to_first_frame_len_when_valid)
 {
     Fixture f;
     f.arq.send_wnd_ptr.valid = 1;
     arq_backend_send_ptr_get(&f.arq, &f.send, &f.size);
-    CHECK_EQUAL(f.arq.send_frame.len, f.size);
+    CHECK_EQUAL(3, f.size);
+    CHECK_EQUAL(3, f.arq.send_frame.held);
+}
+
+TEST(backend_send, send_ptr_get_starts_at_first_unsent_frame)
+{
+    Fixture f;
+    f.arq.send_frame.ofs = 3;
+    arq_backend_send_ptr_get(&f.arq, &f.send, &f.size);
+    CHECK_EQUAL((void const *)&f.buf[3], f.send);
+    CHECK_EQUAL(4, f.size);
+}
+
+TEST(backend_send, send_batch_get_invalid_params)
+{
+    arq_t arq;
+    void const *send;
+    unsigned size;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_batch_get(nullptr, &send, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_batch_get(&arq, nullptr, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_batch_get(&arq, &send, nullptr));
+}
+
+TEST(backend_send, send_batch_get_writes_zero_and_null_when_nothing_to_send)
+{
+    Fixture f;
+    f.send = (void *)1;
+    f.size = 1;
+    f.arq.send_frame.len = 0;
+    arq_err_t const e = arq_backend_send_batch_get(&f.arq, &f.send, &f.size);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL((void const *)NULL, f.send);
+    CHECK_EQUAL(0, f.size);
+    CHECK_EQUAL(ARQ__SEND_FRAME_STATE_FREE, f.arq.send_frame.state);
+}
+
+TEST(backend_send, send_batch_get_returns_every_unsent_frame)
+{
+    Fixture f;
+    arq_backend_send_batch_get(&f.arq, &f.send, &f.size);
+    CHECK_EQUAL((void const *)f.buf, f.send);
+    CHECK_EQUAL(7, f.size);
+    CHECK_EQUAL(7, f.arq.send_frame.held);
+    CHECK_EQUAL(ARQ__SEND_FRAME_STATE_HELD, f.arq.send_frame.state);
+}
+
+TEST(backend_send, send_batch_get_starts_at_first_unsent_frame)
+{
+    Fixture f;
+    f.arq.send_frame.ofs = 3;
+    arq_backend_send_batch_get(&f.arq, &f.send, &f.size);
+    CHECK_EQUAL((void const *)&f.buf[3], f.send);
+    CHECK_EQUAL(4, f.size);
+}
+
+TEST(backend_send, send_iov_get_invalid_params)
+{
+    arq_t arq;
+    arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+    unsigned n;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_iov_get(nullptr, iov, &n));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_iov_get(&arq, nullptr, &n));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_backend_send_iov_get(&arq, iov, nullptr));
+}
+
+TEST(backend_send, send_iov_get_returns_no_vectors_when_nothing_to_send)
+{
+    Fixture f;
+    arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+    unsigned n = 123;
+    f.arq.send_frame.len = 0;
+    arq_err_t const e = arq_backend_send_iov_get(&f.arq, iov, &n);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(0u, n);
+}
+
+TEST(backend_send, send_iov_get_returns_one_vector_for_encoded_frame)
+{
+    Fixture f;
+    arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+    unsigned n;
+    arq_backend_send_iov_get(&f.arq, iov, &n);
+    CHECK_EQUAL(1u, n);
+    CHECK_EQUAL((void const *)f.buf, iov[0].base);
+    CHECK_EQUAL(3u, iov[0].len);
+    CHECK_EQUAL(ARQ__SEND_FRAME_STATE_HELD, f.arq.send_frame.state);
+}
+
+TEST(backend_send, send_iov_get_returns_prefix_segment_and_trailer_for_scatter_gather_frame)
+{
+    Fixture f;
+    arq_uchar_t const seg[] = { 9, 9, 9, 9 };
+    arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+    unsigned n;
+    f.arq.send_frame.len = ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN;
+    f.arq.send_frame.seg = seg;
+    f.arq.send_frame.seg_len = sizeof(seg);
+    arq_backend_send_iov_get(&f.arq, iov, &n);
+    CHECK_EQUAL(3u, n);
+    CHECK_EQUAL((void const *)f.buf, iov[0].base);
+    CHECK_EQUAL((unsigned)ARQ__FRAME_IOV_PREFIX_LEN, iov[0].len);
+    CHECK_EQUAL((void const *)seg, iov[1].base);
+    CHECK_EQUAL(sizeof(seg), iov[1].len);
+    CHECK_EQUAL((void const *)&f.buf[ARQ__FRAME_IOV_PREFIX_LEN], iov[2].base);
+    CHECK_EQUAL((unsigned)ARQ__FRAME_IOV_TRAILER_LEN, iov[2].len);
+    CHECK_EQUAL(ARQ__SEND_FRAME_STATE_HELD, f.arq.send_frame.state);
+}
+
+TEST(backend_send, send_ptr_release_after_iov_get_drops_scatter_gather_segment)
+{
+    Fixture f;
+    arq_uchar_t const seg[] = { 9 };
+    arq_iovec_t iov[ARQ_SEND_IOV_MAX];
+    unsigned n;
+    f.arq.send_frame.len = ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN;
+    f.arq.send_frame.seg = seg;
+    f.arq.send_frame.seg_len = sizeof(seg);
+    arq_backend_send_iov_get(&f.arq, iov, &n);
+    arq_backend_send_ptr_release(&f.arq);
+    CHECK_EQUAL((void const *)NULL, f.arq.send_frame.seg);
+    CHECK_EQUAL(0u, f.arq.send_frame.len);
+}
+
+TEST(backend_send, send_ptr_get_flattens_scatter_gather_frame)
+{
+    Fixture f;
+    arq_uchar_t const seg[] = { 9, 9 };
+    f.arq.send_frame.len = ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN;
+    f.arq.send_frame.seg = seg;
+    f.arq.send_frame.seg_len = sizeof(seg);
+    for (auto i = 0u; i < f.arq.send_frame.len; ++i) {
+        f.buf[i] = 1;
+    }
+    f.buf[f.arq.send_frame.len - 1] = 0;
+    arq_backend_send_ptr_get(&f.arq, &f.send, &f.size);
+    CHECK_EQUAL((void const *)NULL, f.arq.send_frame.seg);
+    CHECK_EQUAL(ARQ__FRAME_IOV_PREFIX_LEN + sizeof(seg) + ARQ__FRAME_IOV_TRAILER_LEN, f.size);
 }
 
 TEST(backend_send, send_ptr_release_invalid_params)
@@ -105,6 +244,25 @@ TEST(backend_send, send_ptr_release_sets_state_to_released)
     CHECK_EQUAL(ARQ__SEND_FRAME_STATE_RELEASED, f.arq.send_frame.state);
 }
 
+TEST(backend_send, send_ptr_release_advances_past_held_frame)
+{
+    Fixture f;
+    arq_backend_send_ptr_get(&f.arq, &f.send, &f.size);
+    arq_backend_send_ptr_release(&f.arq);
+    CHECK_EQUAL(3, f.arq.send_frame.ofs);
+    CHECK_EQUAL(7, f.arq.send_frame.len);
+    CHECK_EQUAL(0, f.arq.send_frame.held);
+}
+
+TEST(backend_send, send_ptr_release_rewinds_buffer_once_drained)
+{
+    Fixture f;
+    arq_backend_send_batch_get(&f.arq, &f.send, &f.size);
+    arq_backend_send_ptr_release(&f.arq);
+    CHECK_EQUAL(0, f.arq.send_frame.ofs);
+    CHECK_EQUAL(0, f.arq.send_frame.len);
+}
+
 TEST(backend_send, send_ptr_release_sets_need_poll_flag)
 {
     Fixture f;
@@ -0,0 +1,78 @@
+#include "arq_in_unit_tests.h"
+#include <CppUTest/TestHarness.h>
+#include <array>
+
+TEST_GROUP(bits) {};
+
+namespace
+{
+
+TEST(bits, words_rounds_up_to_whole_32_bit_words)
+{
+    CHECK_EQUAL(0u, arq__bits_words(0));
+    CHECK_EQUAL(1u, arq__bits_words(1));
+    CHECK_EQUAL(1u, arq__bits_words(32));
+    CHECK_EQUAL(2u, arq__bits_words(33));
+}
+
+TEST(bits, set_clr_and_test_touch_only_their_own_bit)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 33);
+    CHECK_EQUAL(0u, b[0]);
+    CHECK_EQUAL(0x2u, b[1]);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(b.data(), 33));
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(b.data(), 32));
+    arq__bits_set(b.data(), 31);
+    arq__bits_clr(b.data(), 33);
+    CHECK_EQUAL(0x80000000u, b[0]);
+    CHECK_EQUAL(0u, b[1]);
+}
+
+TEST(bits, next_returns_end_if_no_bits_set)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    CHECK_EQUAL(64u, arq__bits_next(b.data(), 0, 64));
+}
+
+TEST(bits, next_finds_first_set_bit_at_or_after_from)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 5);
+    arq__bits_set(b.data(), 40);
+    CHECK_EQUAL(5u, arq__bits_next(b.data(), 5, 64));
+    CHECK_EQUAL(40u, arq__bits_next(b.data(), 6, 64));
+}
+
+TEST(bits, next_doesnt_look_past_end)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 40);
+    CHECK_EQUAL(39u, arq__bits_next(b.data(), 0, 39));
+}
+
+TEST(bits, next_wrap_returns_distance_from_base)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 45);
+    CHECK_EQUAL(5u, arq__bits_next_wrap(b.data(), 48, 40, 0));
+}
+
+TEST(bits, next_wrap_wraps_past_cap_to_bits_before_base)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 2);
+    arq__bits_set(b.data(), 45);
+    CHECK_EQUAL(10u, arq__bits_next_wrap(b.data(), 48, 40, 6));
+    CHECK_EQUAL(10u, arq__bits_next_wrap(b.data(), 48, 40, 10));
+    CHECK_EQUAL(48u, arq__bits_next_wrap(b.data(), 48, 40, 11));
+}
+
+TEST(bits, next_wrap_returns_cap_if_dist_is_out_of_range)
+{
+    std::array< arq_uint32_t, 2 > b{};
+    arq__bits_set(b.data(), 0);
+    CHECK_EQUAL(48u, arq__bits_next_wrap(b.data(), 48, 0, 48));
+}
+
+}
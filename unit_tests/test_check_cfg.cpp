@@ -15,6 +15,16 @@ struct Fixture
         cfg.recv_window_size_in_messages = 1;
         cfg.connection_rst_period = 100;
         cfg.connection_rst_attempts = 10;
+        cfg.retransmission_timeout = 100;
+        cfg.retransmission_timeout_max = 1000;
+        cfg.recv_ring_size_in_frames = 1;
+        cfg.send_ring_size_in_frames = 1;
+        cfg.pacing_rate_in_bytes_per_sec = 0;
+        cfg.pacing_burst_in_bytes = 0;
+        cfg.pacing_ticks_per_sec = 1000;
+        cfg.compact_acks = ARQ_FALSE;
+        cfg.compact_header = ARQ_FALSE;
+        cfg.ack_delay = 0;
     }
     arq_cfg_t cfg;
 };
@@ -39,6 +49,133 @@ TEST(check_cfg, invalid_recv_wnd_size)
     CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
 }
 
+TEST(check_cfg, zero_recv_ring_size_is_valid)
+{
+    Fixture f;
+    f.cfg.recv_ring_size_in_frames = 0;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, zero_send_ring_size_is_valid)
+{
+    Fixture f;
+    f.cfg.send_ring_size_in_frames = 0;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, invalid_rtx_timeout_max_less_than_rtx_timeout)
+{
+    Fixture f;
+    f.cfg.retransmission_timeout_max = f.cfg.retransmission_timeout - 1;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, zero_rtx_timeout_max_is_valid)
+{
+    Fixture f;
+    f.cfg.retransmission_timeout_max = 0;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, rtx_timeout_max_equal_to_rtx_timeout_disables_adaptation)
+{
+    Fixture f;
+    f.cfg.retransmission_timeout_max = f.cfg.retransmission_timeout;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, ack_delay_shorter_than_rtx_timeout_is_valid)
+{
+    Fixture f;
+    f.cfg.ack_delay = f.cfg.retransmission_timeout - 1;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, invalid_ack_delay_not_shorter_than_rtx_timeout)
+{
+    Fixture f;
+    f.cfg.ack_delay = f.cfg.retransmission_timeout;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, compact_header_accepts_windows_up_to_var_max_window)
+{
+    Fixture f;
+    f.cfg.compact_header = ARQ_TRUE;
+    f.cfg.send_iov = ARQ_FALSE;
+    f.cfg.send_window_size_in_messages = ARQ__FRAME_VAR_MAX_WINDOW;
+    f.cfg.recv_window_size_in_messages = ARQ__FRAME_VAR_MAX_WINDOW;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, invalid_compact_header_with_window_over_var_max_window)
+{
+    Fixture f;
+    f.cfg.compact_header = ARQ_TRUE;
+    f.cfg.send_iov = ARQ_FALSE;
+    f.cfg.send_window_size_in_messages = ARQ__FRAME_VAR_MAX_WINDOW + 1;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+    f.cfg.send_window_size_in_messages = 1;
+    f.cfg.recv_window_size_in_messages = ARQ__FRAME_VAR_MAX_WINDOW + 1;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, invalid_compact_header_with_send_iov)
+{
+    Fixture f;
+    f.cfg.compact_header = ARQ_TRUE;
+    f.cfg.send_iov = ARQ_TRUE;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, pacing_burst_is_ignored_without_rate)
+{
+    Fixture f;
+    f.cfg.pacing_burst_in_bytes = 0;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, invalid_pacing_burst_smaller_than_frame)
+{
+    Fixture f;
+    f.cfg.pacing_rate_in_bytes_per_sec = 1000;
+    f.cfg.pacing_burst_in_bytes = arq__frame_len(f.cfg.segment_length_in_bytes) - 1;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, invalid_pacing_burst_too_large_to_scale)
+{
+    Fixture f;
+    f.cfg.pacing_rate_in_bytes_per_sec = 1000;
+    f.cfg.pacing_ticks_per_sec = 1000000;
+    f.cfg.pacing_burst_in_bytes = (0xFFFFFFFFu / 1000000u) + 1;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, invalid_pacing_without_ticks_per_sec)
+{
+    Fixture f;
+    f.cfg.pacing_rate_in_bytes_per_sec = 1000;
+    f.cfg.pacing_burst_in_bytes = arq__frame_len(f.cfg.segment_length_in_bytes);
+    f.cfg.pacing_ticks_per_sec = 0;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
+TEST(check_cfg, pacing_ticks_per_sec_is_ignored_without_rate)
+{
+    Fixture f;
+    f.cfg.pacing_ticks_per_sec = 0;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, pacing_burst_of_one_frame_is_valid)
+{
+    Fixture f;
+    f.cfg.pacing_rate_in_bytes_per_sec = 1000;
+    f.cfg.pacing_burst_in_bytes = arq__frame_len(f.cfg.segment_length_in_bytes);
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
 TEST(check_cfg, invalid_seg_len)
 {
     Fixture f;
@@ -46,6 +183,22 @@ TEST(check_cfg, invalid_seg_len)
     CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
 }
 
+TEST(check_cfg, jumbo_seg_len_is_valid)
+{
+    Fixture f;
+    f.cfg.segment_length_in_bytes = 4096;
+    f.cfg.message_length_in_segments = 4;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+
+TEST(check_cfg, invalid_msg_len_over_16_bits)
+{
+    Fixture f;
+    f.cfg.segment_length_in_bytes = 0x4000;
+    f.cfg.message_length_in_segments = 4;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+}
+
 TEST(check_cfg, invlalid_wnd_len)
 {
     Fixture f;
@@ -69,5 +222,34 @@ TEST(check_cfg, invalid_connection_period)
     CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
 }
 
+#if ARQ_POW2_WINDOWS == 1
+TEST(check_cfg, pow2_windows_rejects_non_power_of_two_sizes)
+{
+    Fixture f;
+    f.cfg.segment_length_in_bytes = 24;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+    f.cfg.segment_length_in_bytes = 32;
+    f.cfg.message_length_in_segments = 3;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+    f.cfg.message_length_in_segments = 4;
+    f.cfg.send_window_size_in_messages = 12;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+    f.cfg.send_window_size_in_messages = 16;
+    f.cfg.recv_window_size_in_messages = 5;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq__check_cfg(&f.cfg));
+    f.cfg.recv_window_size_in_messages = 8;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
+}
+#else
+TEST(check_cfg, generic_windows_accept_non_power_of_two_sizes)
+{
+    Fixture f;
+    f.cfg.segment_length_in_bytes = 24;
+    f.cfg.message_length_in_segments = 3;
+    f.cfg.send_window_size_in_messages = 12;
+    f.cfg.recv_window_size_in_messages = 5;
+    CHECK(ARQ_SUCCEEDED(arq__check_cfg(&f.cfg)));
 }
+#endif
 
+}
@@ -2,6 +2,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include <cstring>
+#include <vector>
 
 TEST_GROUP(cobs) {};
 
@@ -201,5 +202,166 @@ TEST(cobs, decode_maximum_payload_size_every_other_byte_zero)
     MEMCMP_EQUAL(buf, decoded, sizeof(buf));
 }
 
+TEST(cobs, decode_checksum_decodes_like_decode)
+{
+    unsigned char a[256], b[256];
+    for (int i = 0; i < 256; ++i) {
+        a[i] = (unsigned char)((i % 5) ? (i * 31) : 0);
+    }
+    arq__cobs_encode(a, sizeof(a));
+    std::memcpy(b, a, sizeof(a));
+    arq__cobs_decode(a, sizeof(a));
+    arq__cobs_decode_checksum(b, sizeof(b), 0, &arq__crc32_update);
+    MEMCMP_EQUAL(a, b, sizeof(a));
+}
+
+TEST(cobs, decode_checksum_checksums_prefix_of_decoded_payload)
+{
+    for (unsigned checksum_len = 0; checksum_len <= 254; ++checksum_len) {
+        unsigned char buf[256], payload[256];
+        for (int i = 0; i < 256; ++i) {
+            buf[i] = (unsigned char)((i % 3) ? (i * 7) : 0);
+        }
+        arq__cobs_encode(buf, sizeof(buf));
+        std::memcpy(payload, buf, sizeof(buf));
+        arq__cobs_decode(payload, sizeof(payload));
+        arq_uint32_t const crc = arq__cobs_decode_checksum(buf, sizeof(buf), checksum_len, &arq__crc32_update);
+        CHECK_EQUAL(arq_crc32(&payload[1], checksum_len), crc);
+    }
+}
+
+TEST(cobs, find_zero_returns_len_if_no_zero)
+{
+    unsigned char buf[100];
+    std::memset(buf, 0xAA, sizeof(buf));
+    for (unsigned len = 0; len <= sizeof(buf); ++len) {
+        CHECK_EQUAL(len, arq__find_zero(buf, len));
+    }
+}
+
+TEST(cobs, find_zero_returns_index_of_first_zero)
+{
+    unsigned char buf[100];
+    for (unsigned ofs = 0; ofs < 8; ++ofs) {
+        for (unsigned z = 0; z < sizeof(buf) - ofs; ++z) {
+            std::memset(buf, 0x55, sizeof(buf));
+            buf[ofs + z] = 0;
+            buf[sizeof(buf) - 1] = 0;
+            CHECK_EQUAL(z, arq__find_zero(&buf[ofs], sizeof(buf) - ofs));
+            CHECK_EQUAL(z, arq__find_zero(&buf[ofs], z + 1));
+            CHECK_EQUAL(z, arq__find_zero(&buf[ofs], z));
+        }
+    }
+}
+
+void ReferenceCobsEncode(unsigned char *p, unsigned len)
+{
+    unsigned patch = 0;
+    for (unsigned i = 1; i < len - 1; ++i) {
+        if (p[i] == 0) {
+            p[patch] = (unsigned char)(i - patch);
+            patch = i;
+        }
+    }
+    p[patch] = (unsigned char)(len - 1 - patch);
+    p[len - 1] = 0;
+}
+
+TEST(cobs, encode_matches_reference_for_all_lengths_and_zero_densities)
+{
+    unsigned seed = 1;
+    for (unsigned density = 1; density <= 256; density *= 4) {
+        for (unsigned len = 3; len <= 256; ++len) {
+            unsigned char actual[256], expected[256];
+            for (unsigned i = 0; i < len; ++i) {
+                seed = (seed * 1103515245u) + 12345u;
+                expected[i] = ((seed >> 16) % density) ? (unsigned char)((seed >> 8) | 1) : 0;
+            }
+            std::memcpy(actual, expected, len);
+            ReferenceCobsEncode(expected, len);
+            arq__cobs_encode(actual, len);
+            MEMCMP_EQUAL(expected, actual, len);
+        }
+    }
+}
+
+TEST(cobs, encoded_len_adds_a_code_byte_per_block_and_a_delimiter)
+{
+    CHECK_EQUAL(3u, arq__cobs_encoded_len(1));
+    CHECK_EQUAL(256u, arq__cobs_encoded_len(254));
+    CHECK_EQUAL(258u, arq__cobs_encoded_len(255));
+    CHECK_EQUAL(511u, arq__cobs_encoded_len(508));
+    CHECK_EQUAL(513u, arq__cobs_encoded_len(509));
+}
+
+TEST(cobs, decoded_len_is_longest_payload_that_fits)
+{
+    for (unsigned len = 1; len <= 2000; ++len) {
+        unsigned const encoded_len = arq__cobs_encoded_len(len);
+        CHECK_EQUAL(len, arq__cobs_decoded_len(encoded_len));
+        CHECK_EQUAL(len, arq__cobs_decoded_len(arq__cobs_encoded_len(len + 1) - 1));
+    }
 }
 
+TEST(cobs, encode_multi_block_no_zeroes_puts_code_byte_in_front_of_each_block)
+{
+    unsigned const len = 600;
+    std::vector< unsigned char > buf(arq__cobs_encoded_len(len), 0x55);
+    arq__cobs_encode(buf.data(), (unsigned)buf.size());
+    std::vector< unsigned char > encoded(buf.size(), 0x55);
+    encoded[0] = 0xFF;
+    encoded[255] = 0xFF;
+    encoded[510] = (unsigned char)(len - 508 + 1);
+    encoded[buf.size() - 1] = 0;
+    MEMCMP_EQUAL(encoded.data(), buf.data(), buf.size());
+}
+
+TEST(cobs, encode_multi_block_last_code_of_block_points_at_next_block)
+{
+    std::vector< unsigned char > buf(arq__cobs_encoded_len(300), 0x55);
+    buf[1 + 100] = 0;
+    arq__cobs_encode(buf.data(), (unsigned)buf.size());
+    CHECK_EQUAL(101, buf[0]);
+    CHECK_EQUAL(255 - 101, buf[101]);
+    CHECK_EQUAL(300 - 254 + 1, buf[255]);
+    CHECK_EQUAL(0, buf[buf.size() - 1]);
+}
+
+TEST(cobs, multi_block_encode_leaves_no_zeroes_and_decodes_to_payload)
+{
+    unsigned seed = 1;
+    for (unsigned density = 1; density <= 1024; density *= 4) {
+        for (unsigned len = 250; len <= 1100; len += 7) {
+            std::vector< unsigned char > payload(len), buf(arq__cobs_encoded_len(len));
+            for (auto &b : payload) {
+                seed = (seed * 1103515245u) + 12345u;
+                b = ((seed >> 16) % density) ? (unsigned char)((seed >> 8) | 1) : 0;
+            }
+            std::memcpy(&buf[1], payload.data(), len);
+            arq__cobs_encode(buf.data(), (unsigned)buf.size());
+            CHECK_EQUAL(buf.size() - 1, arq__find_zero(buf.data(), (unsigned)buf.size()));
+            arq__cobs_decode(buf.data(), (unsigned)buf.size());
+            MEMCMP_EQUAL(payload.data(), &buf[1], len);
+        }
+    }
+}
+
+TEST(cobs, decode_checksum_checksums_prefix_of_multi_block_payload)
+{
+    unsigned const len = 1000;
+    std::vector< unsigned char > payload(len);
+    for (auto i = 0u; i < len; ++i) {
+        payload[i] = (unsigned char)((i % 3) ? (i * 7) : 0);
+    }
+    for (unsigned checksum_len = 0; checksum_len <= len; checksum_len += 37) {
+        std::vector< unsigned char > buf(arq__cobs_encoded_len(len));
+        std::memcpy(&buf[1], payload.data(), len);
+        arq__cobs_encode(buf.data(), (unsigned)buf.size());
+        arq_uint32_t const crc =
+            arq__cobs_decode_checksum(buf.data(), (unsigned)buf.size(), checksum_len, &arq__crc32_update);
+        CHECK_EQUAL(arq_crc32(payload.data(), checksum_len), crc);
+        MEMCMP_EQUAL(payload.data(), &buf[1], len);
+    }
+}
+
+}
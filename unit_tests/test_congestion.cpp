@@ -0,0 +1,183 @@
+#include "arq_in_unit_tests.h"
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(congestion) {};
+
+namespace {
+
+struct Fixture
+{
+    explicit Fixture(arq_congestion_cb_t cb_) : cb(cb_)
+    {
+        cc.cap = 64;
+        cc.cwnd = 0;
+        cc.ssthresh = 0;
+        cc.acked = 0;
+        cc.rtt_min = ARQ_TIME_INFINITY;
+        cb(&cc, ARQ_CONGESTION_EVENT_RST, 0);
+    }
+    void Acks(unsigned n, arq_time_t rtt)
+    {
+        for (auto i = 0u; i < n; ++i) {
+            cb(&cc, ARQ_CONGESTION_EVENT_ACK, rtt);
+        }
+    }
+    arq_congestion_cb_t cb;
+    arq_congestion_t cc;
+};
+
+TEST(congestion, aimd_rst_starts_with_initial_window_and_slow_start)
+{
+    Fixture f(&arq_congestion_aimd);
+    CHECK_EQUAL(2u, f.cc.cwnd);
+    CHECK_EQUAL(f.cc.cap, f.cc.ssthresh);
+}
+
+TEST(congestion, aimd_slow_start_grows_window_by_one_per_ack)
+{
+    Fixture f(&arq_congestion_aimd);
+    f.Acks(3, 10);
+    CHECK_EQUAL(5u, f.cc.cwnd);
+}
+
+TEST(congestion, aimd_congestion_avoidance_grows_window_by_one_per_window_of_acks)
+{
+    Fixture f(&arq_congestion_aimd);
+    f.cc.cwnd = 8;
+    f.cc.ssthresh = 8;
+    f.Acks(7, 10);
+    CHECK_EQUAL(8u, f.cc.cwnd);
+    f.Acks(1, 10);
+    CHECK_EQUAL(9u, f.cc.cwnd);
+}
+
+TEST(congestion, aimd_loss_halves_window)
+{
+    Fixture f(&arq_congestion_aimd);
+    f.cc.cwnd = 10;
+    f.cc.acked = 3;
+    arq_congestion_aimd(&f.cc, ARQ_CONGESTION_EVENT_LOSS, 0);
+    CHECK_EQUAL(5u, f.cc.cwnd);
+    CHECK_EQUAL(5u, f.cc.ssthresh);
+    CHECK_EQUAL(0u, f.cc.acked);
+}
+
+TEST(congestion, aimd_loss_keeps_ssthresh_at_least_two)
+{
+    Fixture f(&arq_congestion_aimd);
+    f.cc.cwnd = 1;
+    arq_congestion_aimd(&f.cc, ARQ_CONGESTION_EVENT_LOSS, 0);
+    CHECK_EQUAL(2u, f.cc.ssthresh);
+}
+
+TEST(congestion, aimd_timeout_restarts_from_one_message)
+{
+    Fixture f(&arq_congestion_aimd);
+    f.cc.cwnd = 10;
+    arq_congestion_aimd(&f.cc, ARQ_CONGESTION_EVENT_TIMEOUT, 0);
+    CHECK_EQUAL(1u, f.cc.cwnd);
+    CHECK_EQUAL(5u, f.cc.ssthresh);
+}
+
+TEST(congestion, delay_rst_forgets_minimum_rtt)
+{
+    Fixture f(&arq_congestion_delay);
+    f.cc.rtt_min = 5;
+    arq_congestion_delay(&f.cc, ARQ_CONGESTION_EVENT_RST, 0);
+    CHECK_EQUAL(ARQ_TIME_INFINITY, f.cc.rtt_min);
+    CHECK_EQUAL(2u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_ignores_acks_without_rtt_sample)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(3, ARQ_TIME_INFINITY);
+    CHECK_EQUAL(2u, f.cc.cwnd);
+    CHECK_EQUAL(ARQ_TIME_INFINITY, f.cc.rtt_min);
+}
+
+TEST(congestion, delay_tracks_minimum_rtt)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(1, 50);
+    f.Acks(1, 30);
+    f.Acks(1, 40);
+    CHECK_EQUAL(30u, f.cc.rtt_min);
+}
+
+TEST(congestion, delay_slow_start_grows_while_rtt_stays_flat)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(4, 10);
+    CHECK_EQUAL(6u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_slow_start_ends_when_queue_builds)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(1, 10);
+    f.cc.cwnd = 8;
+    f.Acks(1, 20); // 8 * (20 - 10) / 20 = 4 queued
+    CHECK_EQUAL(8u, f.cc.cwnd);
+    CHECK_EQUAL(8u, f.cc.ssthresh);
+}
+
+TEST(congestion, delay_grows_once_per_window_while_nothing_is_queued)
+{
+    Fixture f(&arq_congestion_delay);
+    f.cc.cwnd = 4;
+    f.cc.ssthresh = 4;
+    f.Acks(3, 10);
+    CHECK_EQUAL(4u, f.cc.cwnd);
+    f.Acks(1, 10);
+    CHECK_EQUAL(5u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_holds_window_while_queue_is_between_alpha_and_beta)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(1, 10);
+    f.cc.cwnd = 8;
+    f.cc.ssthresh = 8;
+    f.Acks(8, 14); // 8 * 4 / 14 = 2 queued
+    CHECK_EQUAL(8u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_shrinks_window_once_per_window_while_queue_exceeds_beta)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(1, 10);
+    f.cc.cwnd = 8;
+    f.cc.ssthresh = 8;
+    f.Acks(8, 40); // 8 * 30 / 40 = 6 queued
+    CHECK_EQUAL(7u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_handles_large_rtts_without_overflow)
+{
+    Fixture f(&arq_congestion_delay);
+    f.Acks(1, 0x10000000u);
+    f.cc.cwnd = 8;
+    f.cc.ssthresh = 8;
+    f.Acks(8, 0x40000000u);
+    CHECK_EQUAL(7u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_loss_halves_window)
+{
+    Fixture f(&arq_congestion_delay);
+    f.cc.cwnd = 10;
+    arq_congestion_delay(&f.cc, ARQ_CONGESTION_EVENT_LOSS, 0);
+    CHECK_EQUAL(5u, f.cc.cwnd);
+}
+
+TEST(congestion, delay_timeout_restarts_from_one_message)
+{
+    Fixture f(&arq_congestion_delay);
+    f.cc.cwnd = 10;
+    arq_congestion_delay(&f.cc, ARQ_CONGESTION_EVENT_TIMEOUT, 0);
+    CHECK_EQUAL(1u, f.cc.cwnd);
+}
+
+}
+
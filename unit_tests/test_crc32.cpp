@@ -1,6 +1,7 @@
 #include "arq_in_unit_tests.h"
 #include <CppUTest/TestHarness.h>
 #include <cstring>
+#include <vector>
 
 TEST_GROUP(crc32) {};
 
@@ -22,5 +23,66 @@ TEST(crc32, world)
     CHECK_EQUAL(0x3A771143, worldCrc32);
 }
 
+uint32_t ReferenceCrc32(unsigned char const *p, unsigned len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+TEST(crc32, matches_bitwise_reference_for_all_lengths_and_alignments)
+{
+    std::vector< unsigned char > buf(320);
+    for (auto i = 0u; i < buf.size(); ++i) {
+        buf[i] = (unsigned char)((i * 2654435761u) >> 13);
+    }
+    for (auto ofs = 0u; ofs < 16; ++ofs) {
+        for (auto len = 0u; len <= 300; ++len) {
+            CHECK_EQUAL(ReferenceCrc32(&buf[ofs], len), arq_crc32(&buf[ofs], len));
+        }
+    }
+}
+
+TEST(crc32, update_is_incremental)
+{
+    std::vector< unsigned char > buf(257);
+    for (auto i = 0u; i < buf.size(); ++i) {
+        buf[i] = (unsigned char)(i ^ 0xA5);
+    }
+    for (auto split = 0u; split <= buf.size(); ++split) {
+        uint32_t crc = arq__crc32_update(0xFFFFFFFF, buf.data(), split);
+        crc = arq__crc32_update(crc, &buf[split], (unsigned)buf.size() - split);
+        CHECK_EQUAL(arq_crc32(buf.data(), (unsigned)buf.size()), ~crc);
+    }
 }
 
+TEST(crc32, dispatched_update_matches_table_update_for_large_buffers)
+{
+    arq__crc32_init();
+    std::vector< unsigned char > buf(8192 + 16);
+    for (auto i = 0u; i < buf.size(); ++i) {
+        buf[i] = (unsigned char)((i * 40503u) >> 7);
+    }
+    for (auto ofs = 0u; ofs < 16; ofs += 5) {
+        for (auto len = 0u; len <= 8192; len += (len < 512) ? 1 : 127) {
+            CHECK_EQUAL(arq__crc32_update_sw(0x12345678, &buf[ofs], len),
+                        arq__crc32_update(0x12345678, &buf[ofs], len));
+        }
+    }
+}
+
+TEST(crc32, large_buffer_matches_bitwise_reference)
+{
+    std::vector< unsigned char > buf(65536 + 7);
+    for (auto i = 0u; i < buf.size(); ++i) {
+        buf[i] = (unsigned char)((i * 2654435761u) >> 11);
+    }
+    CHECK_EQUAL(ReferenceCrc32(buf.data(), (unsigned)buf.size()), arq_crc32(buf.data(), (unsigned)buf.size()));
+}
+
+}
@@ -0,0 +1,85 @@
+#include "arq_in_unit_tests.h"
+#include <CppUTest/TestHarness.h>
+#include <cstring>
+#include <vector>
+
+TEST_GROUP(crc32c) {};
+
+namespace {
+
+// RFC 3720 B.4 check value
+
+TEST(crc32c, check_value)
+{
+    char const *digits = "123456789";
+    CHECK_EQUAL(0xE3069283, arq_crc32c(digits, std::strlen(digits)));
+}
+
+TEST(crc32c, hello)
+{
+    char const *hello = "hello";
+    CHECK_EQUAL(0x9A71BB4C, arq_crc32c(hello, std::strlen(hello)));
+}
+
+TEST(crc32c, differs_from_crc32)
+{
+    char const *hello = "hello";
+    CHECK(arq_crc32c(hello, std::strlen(hello)) != arq_crc32(hello, std::strlen(hello)));
+}
+
+uint32_t ReferenceCrc32c(unsigned char const *p, unsigned len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+        }
+    }
+    return ~crc;
+}
+
+struct Fixture
+{
+    Fixture()
+    {
+        for (auto i = 0u; i < buf.size(); ++i) {
+            buf[i] = (unsigned char)((i * 2654435761u) >> 13);
+        }
+    }
+    std::vector< unsigned char > buf = std::vector< unsigned char >(320);
+};
+
+TEST(crc32c, matches_bitwise_reference_for_all_lengths_and_alignments)
+{
+    arq__crc32_init();
+    Fixture f;
+    for (auto ofs = 0u; ofs < 16; ++ofs) {
+        for (auto len = 0u; len <= 300; ++len) {
+            CHECK_EQUAL(ReferenceCrc32c(&f.buf[ofs], len), arq_crc32c(&f.buf[ofs], len));
+        }
+    }
+}
+
+TEST(crc32c, software_fallback_matches_bitwise_reference)
+{
+    Fixture f;
+    for (auto ofs = 0u; ofs < 4; ++ofs) {
+        for (auto len = 0u; len <= 300; ++len) {
+            CHECK_EQUAL(ReferenceCrc32c(&f.buf[ofs], len), ~arq__crc32c_update_sw(0xFFFFFFFF, &f.buf[ofs], len));
+        }
+    }
+}
+
+TEST(crc32c, update_is_incremental)
+{
+    Fixture f;
+    for (auto split = 0u; split <= f.buf.size(); ++split) {
+        uint32_t crc = arq__crc32c_update(0xFFFFFFFF, f.buf.data(), split);
+        crc = arq__crc32c_update(crc, &f.buf[split], (unsigned)f.buf.size() - split);
+        CHECK_EQUAL(arq_crc32c(f.buf.data(), (unsigned)f.buf.size()), ~crc);
+    }
+}
+
+}
+
@@ -3,6 +3,7 @@
 #include <CppUTest/TestHarness.h>
 #include <CppUTestExt/MockSupport.h>
 #include <cstring>
+#include <vector>
 
 TEST_GROUP(frame) {};
 
@@ -14,6 +15,13 @@ TEST(frame, len_is_header_size_plus_segment_length_plus_cobs_overhead_plus_check
     CHECK_EQUAL(ARQ__FRAME_COBS_OVERHEAD + ARQ__FRAME_HEADER_SIZE + len + 4, arq__frame_len(len));
 }
 
+TEST(frame, len_adds_a_cobs_code_byte_per_block_for_jumbo_segments)
+{
+    CHECK_EQUAL(256u, arq__frame_len(ARQ__FRAME_SINGLE_BLOCK_MAX_SEG_LEN));
+    CHECK_EQUAL(258u, arq__frame_len(ARQ__FRAME_SINGLE_BLOCK_MAX_SEG_LEN + 1));
+    CHECK_EQUAL(4096u + ARQ__FRAME_HEADER_SIZE + 4 + 17 + 1, arq__frame_len(4096));
+}
+
 struct Fixture
 {
     Fixture()
@@ -182,6 +190,195 @@ TEST(frame, write_encodes_frame_at_offset_zero)
     arq__frame_write(&f.h, f.seg, &MockChecksum, f.frame, sizeof(f.frame));
 }
 
+unsigned MockArqFrameWriteFused(arq__frame_hdr_t const *h,
+                                void const *seg,
+                                arq__checksum_update_t update,
+                                void *out_frame,
+                                unsigned frame_max)
+{
+    return mock().actualCall("arq__frame_write_fused")
+        .withParameter("h", (void const *)h)
+        .withParameter("seg", seg)
+        .withParameter("update", (void *)update)
+        .withParameter("out_frame", out_frame)
+        .withParameter("frame_max", frame_max)
+        .returnUnsignedIntValue();
+}
+
+TEST(frame, checksum_update_is_null_for_user_checksum)
+{
+    CHECK(arq__frame_checksum_update(&MockChecksum) == nullptr);
+}
+
+TEST(frame, checksum_update_for_builtin_checksums)
+{
+    CHECK(arq__frame_checksum_update(&arq_crc32) == &arq__crc32_update);
+    CHECK(arq__frame_checksum_update(&arq_crc32c) == &arq__crc32c_update);
+}
+
+TEST(frame, write_uses_fused_writer_for_builtin_checksum)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__frame_write_fused, MockArqFrameWriteFused);
+    mock().expectOneCall("arq__frame_write_fused")
+        .withParameter("h", (void const *)&f.h)
+        .withParameter("seg", (void const *)f.seg)
+        .withParameter("update", (void *)&arq__crc32_update)
+        .withParameter("out_frame", (void *)f.frame)
+        .withParameter("frame_max", (unsigned)sizeof(f.frame))
+        .andReturnValue(f.frame_len);
+    mock().expectNoCall("arq__frame_hdr_write");
+    mock().expectNoCall("arq__cobs_encode");
+    unsigned const written = arq__frame_write(&f.h, f.seg, &arq_crc32, f.frame, sizeof(f.frame));
+    CHECK_EQUAL(f.frame_len, written);
+}
+
+arq_uint32_t Crc32(void const *p, unsigned len) { return arq_crc32(p, len); }
+arq_uint32_t Crc32c(void const *p, unsigned len) { return arq_crc32c(p, len); }
+
+void CheckFusedWriteMatchesUnfusedWrite(arq_checksum_t builtin, arq_checksum_t wrapper)
+{
+    arq_uchar_t seg[256];
+    for (auto i = 0u; i < sizeof(seg); ++i) {
+        seg[i] = (i % 7) ? (arq_uchar_t)(i * 13) : 0;
+    }
+    for (auto seg_len = 0u; seg_len <= 238; ++seg_len) {
+        arq__frame_hdr_t h;
+        arq__frame_hdr_init(&h);
+        h.seg_len = seg_len;
+        h.seq_num = seg_len;
+        h.seg = 1;
+        arq_uchar_t fused[256], unfused[256];
+        unsigned const fused_len = arq__frame_write(&h, seg, builtin, fused, sizeof(fused));
+        unsigned const unfused_len = arq__frame_write(&h, seg, wrapper, unfused, sizeof(unfused));
+        CHECK_EQUAL(unfused_len, fused_len);
+        MEMCMP_EQUAL(unfused, fused, unfused_len);
+    }
+}
+
+TEST(frame, fused_write_matches_unfused_write_crc32)
+{
+    CheckFusedWriteMatchesUnfusedWrite(&arq_crc32, &Crc32);
+}
+
+TEST(frame, fused_write_matches_unfused_write_crc32c)
+{
+    CheckFusedWriteMatchesUnfusedWrite(&arq_crc32c, &Crc32c);
+}
+
+void CheckIovWriteMatchesFrameWrite(arq_checksum_t checksum)
+{
+    arq_uchar_t seg[256];
+    for (auto i = 0u; i < sizeof(seg); ++i) {
+        seg[i] = (arq_uchar_t)(1 + (i * 29) % 255);
+    }
+    for (auto seg_len = 0u; seg_len <= 238; ++seg_len) {
+        for (auto seq = 0u; seq < 8; ++seq) { // vary the header so some checksums contain zero bytes
+            arq__frame_hdr_t h;
+            arq__frame_hdr_init(&h);
+            h.seg_len = seg_len;
+            h.seq_num = seq * 97;
+            h.seg_id = seq;
+            h.seg = (seg_len > 0);
+            arq_uchar_t frame[256], iov[ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN];
+            unsigned const frame_len = arq__frame_write(&h, seg, checksum, frame, sizeof(frame));
+            unsigned const iov_frame_len = arq__frame_write_iov(&h, seg, arq__frame_checksum_update(checksum), iov);
+            CHECK_EQUAL(frame_len, iov_frame_len);
+            MEMCMP_EQUAL(frame, iov, ARQ__FRAME_IOV_PREFIX_LEN);
+            MEMCMP_EQUAL(seg, frame + ARQ__FRAME_IOV_PREFIX_LEN, seg_len);
+            MEMCMP_EQUAL(frame + ARQ__FRAME_IOV_PREFIX_LEN + seg_len,
+                         iov + ARQ__FRAME_IOV_PREFIX_LEN,
+                         ARQ__FRAME_IOV_TRAILER_LEN);
+        }
+    }
+}
+
+TEST(frame, iov_write_matches_frame_write_crc32)
+{
+    CheckIovWriteMatchesFrameWrite(&arq_crc32);
+}
+
+TEST(frame, iov_write_matches_frame_write_crc32c)
+{
+    CheckIovWriteMatchesFrameWrite(&arq_crc32c);
+}
+
+arq_uint32_t MockArqCobsDecodeChecksum(void *p, unsigned len, unsigned checksum_len, arq__checksum_update_t update)
+{
+    return (arq_uint32_t)mock().actualCall("arq__cobs_decode_checksum")
+        .withParameter("p", p)
+        .withParameter("len", len)
+        .withParameter("checksum_len", checksum_len)
+        .withParameter("update", (void *)update)
+        .returnUnsignedIntValue();
+}
+
+TEST(frame, read_decodes_and_checksums_in_one_pass_for_builtin_checksum)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__cobs_decode_checksum, MockArqCobsDecodeChecksum);
+    f.h.version = 0;
+    mock().expectOneCall("arq__cobs_decode_checksum")
+        .withParameter("p", (void *)f.frame)
+        .withParameter("len", f.frame_len)
+        .withParameter("checksum_len", ARQ__FRAME_HEADER_SIZE + f.h.seg_len)
+        .withParameter("update", (void *)&arq__crc32_update);
+    mock().expectNoCall("arq__cobs_decode");
+    mock().expectNoCall("arq__frame_checksum_read");
+    mock().ignoreOtherCalls();
+    void const *seg;
+    arq__frame_read(f.frame, f.frame_len, &arq_crc32, &f.h, &seg);
+}
+
+TEST(frame, fused_read_returns_success_if_checksum_matches)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__cobs_decode_checksum, MockArqCobsDecodeChecksum);
+    ARQ_MOCK_UNHOOK(arq__ntoh32);
+    ARQ_MOCK_UNHOOK(arq__hton32);
+    f.h.version = 0;
+    arq_uchar_t const checksum_n[] = { 0x11, 0x22, 0x33, 0x44 };
+    std::memcpy(&f.frame[1 + ARQ__FRAME_HEADER_SIZE + f.h.seg_len], checksum_n, 4);
+    mock().expectOneCall("arq__cobs_decode_checksum").ignoreOtherParameters().andReturnValue(0x11223344);
+    mock().ignoreOtherCalls();
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(f.frame, f.frame_len, &arq_crc32, &f.h, &seg));
+}
+
+TEST(frame, fused_read_returns_bad_checksum_if_checksum_doesnt_match)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__cobs_decode_checksum, MockArqCobsDecodeChecksum);
+    ARQ_MOCK_UNHOOK(arq__ntoh32);
+    ARQ_MOCK_UNHOOK(arq__hton32);
+    f.h.version = 0;
+    arq_uchar_t const checksum_n[] = { 0x11, 0x22, 0x33, 0x44 };
+    std::memcpy(&f.frame[1 + ARQ__FRAME_HEADER_SIZE + f.h.seg_len], checksum_n, 4);
+    mock().expectOneCall("arq__cobs_decode_checksum").ignoreOtherParameters().andReturnValue(0x11223345);
+    mock().ignoreOtherCalls();
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM,
+                arq__frame_read(f.frame, f.frame_len, &arq_crc32, &f.h, &seg));
+}
+
+TEST(frame, fused_read_falls_back_to_checksum_read_if_seg_len_disagrees_with_frame_len)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__cobs_decode_checksum, MockArqCobsDecodeChecksum);
+    f.h.version = 0;
+    f.h.seg_len = sizeof(f.seg) + 1;
+    mock().expectOneCall("arq__frame_checksum_read")
+        .withParameter("frame", (void const *)f.frame)
+        .withParameter("frame_len", f.frame_len)
+        .withParameter("seg_len", f.h.seg_len)
+        .withParameter("checksum", (void *)&arq_crc32)
+        .andReturnValue(ARQ__FRAME_READ_RESULT_ERR_MALFORMED);
+    mock().ignoreOtherCalls();
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_MALFORMED,
+                arq__frame_read(f.frame, f.frame_len, &arq_crc32, &f.h, &seg));
+}
+
 TEST(frame, write_seg_copies_segment_into_buffer)
 {
     Fixture f;
@@ -306,6 +503,48 @@ TEST(frame, checksum_read_returns_success_if_computed_checksum_matches_frame_che
     CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
 }
 
+TEST(frame, version_is_zero_for_user_checksum)
+{
+    CHECK_EQUAL(0, arq__frame_version(&MockChecksum));
+    CHECK_EQUAL(0, arq__frame_version(&arq_crc32));
+}
+
+TEST(frame, version_names_crc32c_in_high_nibble)
+{
+    CHECK_EQUAL(ARQ__FRAME_VERSION_CHECKSUM_CRC32C, arq__frame_version(&arq_crc32c));
+    CHECK_EQUAL(0, ARQ__FRAME_VERSION_CHECKSUM_CRC32C & ~ARQ__FRAME_VERSION_CHECKSUM_MASK);
+}
+
+TEST(frame, read_returns_version_error_if_frame_checksum_doesnt_match_configured_checksum)
+{
+    MockFixture f;
+    f.h.version = ARQ__FRAME_VERSION_CHECKSUM_CRC32C;
+    mock().expectNoCall("arq__frame_checksum_read");
+    mock().ignoreOtherCalls();
+    void const *seg;
+    arq__frame_read_result_t const r = arq__frame_read(f.frame, f.frame_len, MockChecksum, &f.h, &seg);
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_VERSION, r);
+}
+
+TEST(frame, read_verifies_checksum_if_frame_checksum_matches_configured_checksum)
+{
+    MockFixture f;
+    ARQ_MOCK_HOOK(arq__cobs_decode_checksum, MockArqCobsDecodeChecksum);
+    ARQ_MOCK_UNHOOK(arq__ntoh32);
+    ARQ_MOCK_UNHOOK(arq__hton32);
+    f.h.version = ARQ__FRAME_VERSION_CHECKSUM_CRC32C | 0x03;
+    arq_uchar_t const checksum_n[] = { 0x11, 0x22, 0x33, 0x44 };
+    std::memcpy(&f.frame[1 + ARQ__FRAME_HEADER_SIZE + f.h.seg_len], checksum_n, 4);
+    mock().expectOneCall("arq__cobs_decode_checksum")
+        .withParameter("update", (void *)&arq__crc32c_update)
+        .ignoreOtherParameters()
+        .andReturnValue(0x11223344);
+    mock().ignoreOtherCalls();
+    void const *seg;
+    arq__frame_read_result_t const r = arq__frame_read(f.frame, f.frame_len, &arq_crc32c, &f.h, &seg);
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, r);
+}
+
 TEST(frame, read_reads_frame_header_at_offset_1)
 {
     MockFixture f;
@@ -326,5 +565,341 @@ TEST(frame, read_points_out_seg_to_segment_in_frame)
     CHECK_EQUAL((void *)&f.frame[1 + ARQ__FRAME_HEADER_SIZE], seg);
 }
 
+
+TEST(frame, compact_len_is_half_of_full_frame_without_payload)
+{
+    CHECK_EQUAL(arq__frame_len(0) / 2, ARQ__FRAME_COMPACT_LEN);
 }
 
+struct CompactFixture
+{
+    CompactFixture()
+    {
+        arq__frame_hdr_init(&h);
+        h.version = ARQ__FRAME_VERSION_CHECKSUM_CRC32C;
+        h.ack_num = 0xABC;
+        h.cur_ack_vec = 0x5A5;
+        h.win_size = 200;
+        h.ack = ARQ_TRUE;
+        h.win = ARQ_TRUE;
+        std::memset(frame, 0xFF, sizeof(frame));
+    }
+    arq__frame_hdr_t h;
+    arq_uchar_t frame[ARQ__FRAME_COMPACT_LEN];
+};
+
+TEST(frame, compact_write_returns_compact_len_and_encodes_frame)
+{
+    CompactFixture f;
+    CHECK_EQUAL(ARQ__FRAME_COMPACT_LEN, arq__frame_compact_write(&f.h, &arq_crc32c, f.frame, sizeof(f.frame)));
+    CHECK_EQUAL(ARQ__FRAME_COMPACT_LEN - 1, arq__find_zero(f.frame, sizeof(f.frame)));
+}
+
+TEST(frame, compact_write_round_trips_through_frame_read)
+{
+    CompactFixture f;
+    for (auto flags = 0u; flags < 16; ++flags) {
+        f.h.fin = (arq_bool_t)!!(flags & 1);
+        f.h.rst = (arq_bool_t)!!(flags & 2);
+        f.h.ack = (arq_bool_t)!!(flags & 4);
+        f.h.win = (arq_bool_t)!!(flags & 8);
+        arq__frame_compact_write(&f.h, &arq_crc32c, f.frame, sizeof(f.frame));
+        arq__frame_hdr_t r;
+        void const *seg;
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(f.frame, sizeof(f.frame), &arq_crc32c, &r, &seg));
+        CHECK_EQUAL(f.h.version, r.version);
+        CHECK_EQUAL(f.h.fin, r.fin);
+        CHECK_EQUAL(f.h.rst, r.rst);
+        CHECK_EQUAL(f.h.ack, r.ack);
+        CHECK_EQUAL(f.h.win, r.win);
+        CHECK_EQUAL(f.h.ack_num, r.ack_num);
+        CHECK_EQUAL(f.h.cur_ack_vec, r.cur_ack_vec);
+        CHECK_EQUAL(f.h.win_size, r.win_size);
+        CHECK_EQUAL(ARQ_FALSE, r.seg);
+        CHECK_EQUAL(0, r.seg_len);
+        POINTERS_EQUAL(nullptr, r.sack);
+    }
+}
+
+arq__frame_read_result_t MockArqFrameCompactRead(void *frame, arq_checksum_t checksum, arq__frame_hdr_t *out_hdr)
+{
+    return (arq__frame_read_result_t)mock().actualCall("arq__frame_compact_read")
+        .withParameter("frame", frame)
+        .withParameter("checksum", (void *)checksum)
+        .withParameter("out_hdr", out_hdr)
+        .returnIntValue();
+}
+
+TEST(frame, read_hands_frames_of_compact_len_to_compact_read)
+{
+    CompactFixture f;
+    ARQ_MOCK_HOOK(arq__frame_compact_read, MockArqFrameCompactRead);
+    mock().expectOneCall("arq__frame_compact_read")
+        .withParameter("frame", (void *)f.frame)
+        .withParameter("checksum", (void *)&arq_crc32)
+        .withParameter("out_hdr", &f.h)
+        .andReturnValue(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM);
+    mock().expectNoCall("arq__cobs_decode_checksum");
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM, arq__frame_read(f.frame, sizeof(f.frame), &arq_crc32, &f.h, &seg));
+}
+
+TEST(frame, compact_read_returns_version_error_if_frame_checksum_doesnt_match_configured_checksum)
+{
+    CompactFixture f;
+    arq__frame_compact_write(&f.h, &arq_crc32, f.frame, sizeof(f.frame)); // intact, but stamped crc32c
+    arq__frame_hdr_t r;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_VERSION, arq__frame_compact_read(f.frame, &arq_crc32, &r));
+}
+
+TEST(frame, compact_read_returns_bad_checksum_if_version_byte_is_corrupted)
+{
+    CompactFixture f;
+    arq__frame_compact_write(&f.h, &arq_crc32c, f.frame, sizeof(f.frame));
+    arq__cobs_decode(f.frame, sizeof(f.frame));
+    f.frame[1] ^= ARQ__FRAME_VERSION_CHECKSUM_CRC32C;
+    arq__cobs_encode(f.frame, sizeof(f.frame));
+    arq__frame_hdr_t r;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM, arq__frame_compact_read(f.frame, &arq_crc32c, &r));
+}
+
+TEST(frame, compact_read_returns_bad_checksum_if_any_header_byte_changes)
+{
+    CompactFixture f;
+    for (auto i = 1u; i <= ARQ__FRAME_COMPACT_HEADER_SIZE; ++i) {
+        arq__frame_compact_write(&f.h, &arq_crc32c, f.frame, sizeof(f.frame));
+        arq__cobs_decode(f.frame, sizeof(f.frame));
+        f.frame[i] ^= 0x01;
+        arq__cobs_encode(f.frame, sizeof(f.frame));
+        arq__frame_hdr_t r;
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM, arq__frame_compact_read(f.frame, &arq_crc32c, &r));
+    }
+}
+
+
+TEST(frame, var_hdr_write_omits_absent_fields)
+{
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    arq_uchar_t buf[ARQ__FRAME_HEADER_SIZE];
+    CHECK_EQUAL(ARQ__FRAME_VAR_HEADER_MIN_SIZE, arq__frame_var_hdr_write(&h, buf));
+    h.seg = ARQ_TRUE;
+    h.seg_len = 8;
+    h.msg_len = 1;
+    CHECK_EQUAL(ARQ__FRAME_VAR_HEADER_MIN_SIZE + 1, arq__frame_var_hdr_write(&h, buf));
+    h.msg_len = 2;
+    CHECK_EQUAL(ARQ__FRAME_VAR_HEADER_MIN_SIZE + 3, arq__frame_var_hdr_write(&h, buf));
+    h.seg = ARQ_FALSE;
+    h.win = ARQ_TRUE;
+    CHECK_EQUAL(ARQ__FRAME_VAR_HEADER_MIN_SIZE + 3, arq__frame_var_hdr_write(&h, buf));
+    h.ack = ARQ_TRUE;
+    CHECK_EQUAL(ARQ__FRAME_VAR_HEADER_MIN_SIZE + 4, arq__frame_var_hdr_write(&h, buf));
+}
+
+TEST(frame, var_hdr_read_returns_zero_if_flags_need_more_than_len)
+{
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.ack = ARQ_TRUE;
+    h.win = ARQ_TRUE;
+    arq_uchar_t buf[ARQ__FRAME_HEADER_SIZE];
+    unsigned const len = arq__frame_var_hdr_write(&h, buf);
+    CHECK_EQUAL(0, arq__frame_var_hdr_read(buf, len - 1, &h));
+    CHECK_EQUAL(len, arq__frame_var_hdr_read(buf, len, &h));
+}
+
+TEST(frame, var_frame_that_would_be_compact_len_is_padded_past_it)
+{
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    h.seg = ARQ_TRUE;
+    h.msg_len = 1;
+    h.seq_num = 0x21;
+    h.seg_len = 0;
+    arq_uchar_t frame[64];
+    unsigned const frame_len = arq__frame_write(&h, nullptr, &arq_crc32, frame, sizeof(frame));
+    CHECK_EQUAL(ARQ__FRAME_COMPACT_LEN + 1, frame_len);
+    arq__frame_hdr_t r;
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(frame, frame_len, &arq_crc32, &r, &seg));
+    CHECK_EQUAL(ARQ_TRUE, r.seg);
+    CHECK_EQUAL(0x21, r.seq_num);
+    CHECK_EQUAL(0, r.seg_len);
+}
+
+void CheckVarFrameRoundTrip(arq_checksum_t checksum)
+{
+    arq_uchar_t const seg[] = { 0, 1, 2, 0, 4, 5, 6, 7, 8, 9 };
+    for (auto flags = 0u; flags < 32; ++flags) {
+        arq__frame_hdr_t h;
+        arq__frame_hdr_init(&h);
+        h.version = arq__frame_version(checksum) | ARQ__FRAME_VERSION_LAYOUT_VAR;
+        h.fin = (arq_bool_t)!!(flags & 1);
+        h.ack = (arq_bool_t)!!(flags & 2);
+        h.win = (arq_bool_t)!!(flags & 4);
+        h.seg = (arq_bool_t)!!(flags & 8);
+        h.seg_len = h.seg ? sizeof(seg) : 0;
+        h.msg_len = (flags & 16) ? 7 : 1;
+        h.seg_id = (flags & 16) ? 5 : 0;
+        h.seq_num = 0x9A5;
+        h.ack_num = 0xABC;
+        h.cur_ack_vec = h.ack ? 0x5A5 : 0;
+        h.win_size = 17;
+        arq_uchar_t frame[64];
+        unsigned const frame_len = arq__frame_write(&h, seg, checksum, frame, sizeof(frame));
+        CHECK(frame_len < arq__frame_len(h.seg_len));
+        CHECK_EQUAL(frame_len - 1, arq__find_zero(frame, frame_len));
+        arq__frame_hdr_t r;
+        void const *r_seg;
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(frame, frame_len, checksum, &r, &r_seg));
+        CHECK_EQUAL(h.version, r.version);
+        CHECK_EQUAL(h.fin, r.fin);
+        CHECK_EQUAL(h.ack, r.ack);
+        CHECK_EQUAL(h.win, r.win);
+        CHECK_EQUAL(h.seg, r.seg);
+        CHECK_EQUAL(h.seg_len, r.seg_len);
+        if (h.seg) {
+            CHECK_EQUAL(h.seq_num & 0xFF, r.seq_num);
+            CHECK_EQUAL(h.msg_len, r.msg_len);
+            CHECK_EQUAL(h.seg_id, r.seg_id);
+            MEMCMP_EQUAL(seg, r_seg, sizeof(seg));
+        }
+        if (h.ack || h.win) {
+            CHECK_EQUAL(h.ack_num, r.ack_num);
+            CHECK_EQUAL(h.cur_ack_vec, r.cur_ack_vec);
+        }
+        if (h.win) {
+            CHECK_EQUAL(h.win_size, r.win_size);
+        }
+    }
+}
+
+TEST(frame, var_frame_round_trips_through_frame_read_crc32)
+{
+    CheckVarFrameRoundTrip(&arq_crc32);
+}
+
+TEST(frame, var_frame_round_trips_through_frame_read_user_checksum)
+{
+    CheckVarFrameRoundTrip(&Crc32);
+}
+
+TEST(frame, var_frame_carries_sack_block_as_payload)
+{
+    arq_uchar_t const sack[] = { 1, 2, 3, 4, 5 };
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    h.ack = ARQ_TRUE;
+    h.sack = sack;
+    h.seg_len = sizeof(sack);
+    arq_uchar_t frame[64];
+    unsigned const frame_len = arq__frame_write(&h, sack, &arq_crc32, frame, sizeof(frame));
+    arq__frame_hdr_t r;
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(frame, frame_len, &arq_crc32, &r, &seg));
+    CHECK_EQUAL(sizeof(sack), r.seg_len);
+    POINTERS_EQUAL(seg, r.sack);
+    MEMCMP_EQUAL(sack, seg, sizeof(sack));
+}
+
+TEST(frame, var_frame_read_returns_version_error_if_frame_checksum_doesnt_match_configured_checksum)
+{
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.version = ARQ__FRAME_VERSION_CHECKSUM_CRC32C | ARQ__FRAME_VERSION_LAYOUT_VAR;
+    h.ack = ARQ_TRUE;
+    arq_uchar_t frame[64];
+    unsigned const frame_len = arq__frame_write(&h, nullptr, &arq_crc32c, frame, sizeof(frame));
+    void const *seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_VERSION, arq__frame_read(frame, frame_len, &arq_crc32, &h, &seg));
+}
+
+TEST(frame, var_frame_read_returns_bad_checksum_if_any_byte_changes)
+{
+    arq_uchar_t const seg[] = { 9, 8, 7 };
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    h.seg = ARQ_TRUE;
+    h.msg_len = 1;
+    h.seq_num = 3;
+    h.seg_len = sizeof(seg);
+    arq_uchar_t frame[64];
+    unsigned const frame_len = arq__frame_write(&h, seg, &arq_crc32, frame, sizeof(frame));
+    for (auto i = 2u; i < frame_len - 1; ++i) { // the version byte picks the layout, so leave it be
+        arq__frame_write(&h, seg, &arq_crc32, frame, sizeof(frame));
+        arq__cobs_decode(frame, frame_len);
+        frame[i] ^= 0x01;
+        arq__cobs_encode(frame, frame_len);
+        arq__frame_hdr_t r;
+        void const *r_seg;
+        CHECK(ARQ__FRAME_READ_RESULT_SUCCESS != arq__frame_read(frame, frame_len, &arq_crc32, &r, &r_seg));
+    }
+}
+
+void CheckJumboFrameRoundTrip(arq_checksum_t checksum, unsigned layout)
+{
+    std::vector< arq_uchar_t > seg(4096);
+    for (auto i = 0u; i < seg.size(); ++i) {
+        seg[i] = (i % 300) ? (arq_uchar_t)(i * 13) : 0;
+    }
+    unsigned const seg_lens[] = { ARQ__FRAME_SINGLE_BLOCK_MAX_SEG_LEN + 1, 508, 1000, 4096 };
+    for (auto seg_len : seg_lens) {
+        arq__frame_hdr_t h;
+        arq__frame_hdr_init(&h);
+        h.version = arq__frame_version(checksum) | layout;
+        h.seg = ARQ_TRUE;
+        h.seg_len = seg_len;
+        h.msg_len = 1;
+        h.seq_num = 0x21;
+        std::vector< arq_uchar_t > frame(arq__frame_len(seg_len));
+        unsigned const frame_len = arq__frame_write(&h, seg.data(), checksum, frame.data(), (unsigned)frame.size());
+        CHECK(frame_len <= frame.size());
+        CHECK_EQUAL(frame_len - 1, arq__find_zero(frame.data(), frame_len));
+        arq__frame_hdr_t r;
+        void const *r_seg;
+        CHECK_EQUAL(ARQ__FRAME_READ_RESULT_SUCCESS, arq__frame_read(frame.data(), frame_len, checksum, &r, &r_seg));
+        CHECK_EQUAL(seg_len, r.seg_len);
+        CHECK_EQUAL(h.seq_num, r.seq_num);
+        MEMCMP_EQUAL(seg.data(), r_seg, seg_len);
+    }
+}
+
+TEST(frame, jumbo_frame_round_trips_through_frame_read_crc32)
+{
+    CheckJumboFrameRoundTrip(&arq_crc32, 0);
+}
+
+TEST(frame, jumbo_frame_round_trips_through_frame_read_crc32c)
+{
+    CheckJumboFrameRoundTrip(&arq_crc32c, 0);
+}
+
+TEST(frame, jumbo_frame_round_trips_through_frame_read_user_checksum)
+{
+    CheckJumboFrameRoundTrip(&Crc32, 0);
+}
+
+TEST(frame, jumbo_var_frame_round_trips_through_frame_read)
+{
+    CheckJumboFrameRoundTrip(&arq_crc32, ARQ__FRAME_VERSION_LAYOUT_VAR);
+}
+
+TEST(frame, jumbo_frame_read_returns_bad_checksum_if_a_byte_in_a_later_block_changes)
+{
+    std::vector< arq_uchar_t > seg(1000, 0x5A);
+    arq__frame_hdr_t h;
+    arq__frame_hdr_init(&h);
+    h.seg = ARQ_TRUE;
+    h.seg_len = (unsigned)seg.size();
+    std::vector< arq_uchar_t > frame(arq__frame_len(h.seg_len));
+    unsigned const frame_len = arq__frame_write(&h, seg.data(), &arq_crc32, frame.data(), (unsigned)frame.size());
+    frame[700] ^= 0x01;
+    arq__frame_hdr_t r;
+    void const *r_seg;
+    CHECK_EQUAL(ARQ__FRAME_READ_RESULT_ERR_CHECKSUM, arq__frame_read(frame.data(), frame_len, &arq_crc32, &r, &r_seg));
+}
+
+}
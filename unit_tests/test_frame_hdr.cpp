@@ -35,6 +35,8 @@ TEST(frame_hdr, init_sets_all_fields_to_zero)
     CHECK_EQUAL(0, h.fin);
     CHECK_EQUAL(0, h.ack);
     CHECK_EQUAL(0, h.seg);
+    CHECK_EQUAL(0, h.win);
+    POINTERS_EQUAL(nullptr, h.sack);
 }
 
 struct ReadFixture
@@ -67,6 +69,18 @@ TEST(frame_hdr, read_segment_length)
     CHECK_EQUAL(SegmentLength, f.h.seg_len);
 }
 
+TEST(frame_hdr, read_segment_length_high_byte)
+{
+    ReadFixture f;
+    f.buf[1] = 0x34;
+    f.buf[9] |= 0x01;
+    f.buf[10] |= 0x20;
+    arq__frame_hdr_read(f.buf, &f.h);
+    CHECK_EQUAL(0x1234, f.h.seg_len);
+    CHECK_EQUAL(AckNumber, f.h.ack_num);
+    CHECK_EQUAL(AckSegmentMask, f.h.cur_ack_vec);
+}
+
 TEST(frame_hdr, read_rst_flag)
 {
     ReadFixture f;
@@ -111,6 +125,28 @@ TEST(frame_hdr, read_seg_flag)
     CHECK_EQUAL(0, (int)f.h.seg);
 }
 
+TEST(frame_hdr, read_sack_flag_points_sack_at_payload)
+{
+    ReadFixture f;
+    f.buf[2] = 1 << 4;
+    arq__frame_hdr_read(f.buf, &f.h);
+    POINTERS_EQUAL(f.buf + ARQ__FRAME_HEADER_SIZE, f.h.sack);
+    f.buf[2] = 0;
+    arq__frame_hdr_read(f.buf, &f.h);
+    POINTERS_EQUAL(nullptr, f.h.sack);
+}
+
+TEST(frame_hdr, read_win_flag)
+{
+    ReadFixture f;
+    f.buf[2] = 1 << 5;
+    arq__frame_hdr_read(f.buf, &f.h);
+    CHECK_EQUAL(1, (int)f.h.win);
+    f.buf[2] = 0;
+    arq__frame_hdr_read(f.buf, &f.h);
+    CHECK_EQUAL(0, (int)f.h.win);
+}
+
 TEST(frame_hdr, read_window_size)
 {
     ReadFixture f;
@@ -157,6 +193,8 @@ struct WriteFixture
         h.fin = 0;
         h.seg = 0;
         h.ack = 0;
+        h.win = 0;
+        h.sack = nullptr;
         h.win_size = WindowSize;
         h.seq_num = SequenceNumber;
         h.msg_len = MessageLength;
@@ -182,6 +220,16 @@ TEST(frame_hdr, write_segment_length)
     CHECK_EQUAL((uint8_t)SegmentLength, (uint8_t)f.buf[1]);
 }
 
+TEST(frame_hdr, write_segment_length_high_byte_between_ack_number_and_ack_segment_mask)
+{
+    WriteFixture f;
+    f.h.seg_len = 0x1234;
+    arq__frame_hdr_write(&f.h, f.buf);
+    CHECK_EQUAL((uint8_t)0x34, (uint8_t)f.buf[1]);
+    CHECK_EQUAL((uint8_t)0x41, (uint8_t)f.buf[9]);
+    CHECK_EQUAL((uint8_t)0x22, (uint8_t)f.buf[10]);
+}
+
 TEST(frame_hdr, write_rst_flag)
 {
     WriteFixture f;
@@ -226,6 +274,29 @@ TEST(frame_hdr, write_seg_flag)
     CHECK_EQUAL(0, f.buf[2] & 8);
 }
 
+TEST(frame_hdr, write_sack_flag)
+{
+    WriteFixture f;
+    char blk[4];
+    f.h.sack = blk;
+    arq__frame_hdr_write(&f.h, f.buf);
+    CHECK(f.buf[2] & 16);
+    f.h.sack = nullptr;
+    arq__frame_hdr_write(&f.h, f.buf);
+    CHECK_EQUAL(0, f.buf[2] & 16);
+}
+
+TEST(frame_hdr, write_win_flag)
+{
+    WriteFixture f;
+    f.h.win = 1;
+    arq__frame_hdr_write(&f.h, f.buf);
+    CHECK(f.buf[2] & 32);
+    f.h.win = 0;
+    arq__frame_hdr_write(&f.h, f.buf);
+    CHECK_EQUAL(0, f.buf[2] & 32);
+}
+
 TEST(frame_hdr, write_window_size)
 {
     WriteFixture f;
@@ -281,6 +352,8 @@ TEST(frame_hdr, headers_identical)
     orig.seg_len = SegmentLength;
     orig.rst = 1;
     orig.fin = 0;
+    orig.win = 0;
+    orig.sack = nullptr;
     orig.win_size = WindowSize;
     orig.seq_num = SequenceNumber;
     orig.msg_len = MessageLength;
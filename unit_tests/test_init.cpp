@@ -129,11 +129,53 @@ TEST(init, returns_success)
     cfg.message_length_in_segments = 1;
     cfg.connection_rst_period = 100;
     cfg.connection_rst_attempts = 3;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 1000;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 4;
+    cfg.send_ring_size_in_frames = 4;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
     std::vector< arq_uchar_t > seat(1024 * 1024);
     arq_t *arq;
     arq_err_t const e = arq_init(&cfg, seat.data(), seat.size(), &arq);
     CHECK_EQUAL(ARQ_OK_COMPLETED, e);
 }
 
+TEST(init, zero_ring_sizes_and_rtx_timeout_max_are_optional)
+{
+    arq_cfg_t cfg;
+    cfg.send_window_size_in_messages = 1;
+    cfg.recv_window_size_in_messages = 1;
+    cfg.segment_length_in_bytes = 64;
+    cfg.message_length_in_segments = 1;
+    cfg.connection_rst_period = 100;
+    cfg.connection_rst_attempts = 3;
+    cfg.retransmission_timeout = 100;
+    cfg.retransmission_timeout_max = 0;
+    cfg.congestion = nullptr;
+    cfg.recv_ring_size_in_frames = 0;
+    cfg.send_ring_size_in_frames = 0;
+    cfg.send_iov = ARQ_FALSE;
+    cfg.pacing_rate_in_bytes_per_sec = 0;
+    cfg.pacing_burst_in_bytes = 0;
+    cfg.pacing_ticks_per_sec = 1000;
+    cfg.compact_acks = ARQ_FALSE;
+    cfg.compact_header = ARQ_FALSE;
+    cfg.ack_delay = 0;
+    unsigned size;
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_required_size(&cfg, &size));
+    std::vector< arq_uchar_t > seat(size);
+    arq_t *arq;
+    arq_err_t const e = arq_init(&cfg, seat.data(), seat.size(), &arq);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    CHECK_EQUAL(1u, arq->recv_ring.cap);
+    CHECK_EQUAL(100, arq->send_wnd.rto_max);
 }
 
+}
@@ -20,9 +20,11 @@ void MockSendFrameInit(arq__send_frame_t *f, unsigned cap)
     mock().actualCall("arq__send_frame_init").withParameter("f", f).withParameter("cap", cap);
 }
 
-void MockRecvFrameInit(arq__recv_frame_t *f, unsigned cap)
+void MockRecvRingInit(arq__recv_ring_t *r, unsigned cap, unsigned frame_cap)
 {
-    mock().actualCall("arq__recv_frame_init").withParameter("f", f).withParameter("cap", cap);
+    mock().actualCall("arq__recv_ring_init").withParameter("r", r)
+                                            .withParameter("cap", cap)
+                                            .withParameter("frame_cap", frame_cap);
 }
 
 struct Fixture
@@ -31,11 +33,19 @@ struct Fixture
     {
         ARQ_MOCK_HOOK(arq__wnd_init, MockWndInit);
         ARQ_MOCK_HOOK(arq__send_frame_init, MockSendFrameInit);
-        ARQ_MOCK_HOOK(arq__recv_frame_init, MockRecvFrameInit);
+        ARQ_MOCK_HOOK(arq__recv_ring_init, MockRecvRingInit);
         arq.cfg.message_length_in_segments = 16;
         arq.cfg.segment_length_in_bytes = 64;
         arq.cfg.send_window_size_in_messages = 32;
         arq.cfg.recv_window_size_in_messages = 19;
+        arq.cfg.recv_ring_size_in_frames = 7;
+        arq.cfg.send_ring_size_in_frames = 5;
+        arq.cfg.pacing_rate_in_bytes_per_sec = 0;
+        arq.cfg.pacing_burst_in_bytes = 0;
+        arq.cfg.pacing_ticks_per_sec = 1000;
+        arq.cfg.compact_acks = ARQ_FALSE;
+        arq.cfg.compact_header = ARQ_FALSE;
+        arq.cfg.ack_delay = 0;
     }
     arq_t arq;
 };
@@ -66,24 +76,118 @@ TEST(init_intl, initializes_recv_window)
     arq__init(&f.arq);
 }
 
-TEST(init_intl, initializes_send_frame)
+TEST(init_intl, initializes_send_frame_with_room_for_send_ring)
 {
     Fixture f;
     unsigned const frame_len = arq__frame_len(f.arq.cfg.segment_length_in_bytes);
     mock().expectOneCall("arq__send_frame_init").withParameter("f", &f.arq.send_frame)
-                                                .withParameter("cap", frame_len);
+                                                .withParameter("cap", frame_len * f.arq.cfg.send_ring_size_in_frames);
     mock().ignoreOtherCalls();
     arq__init(&f.arq);
 }
 
-TEST(init_intl, initializes_recv_frame)
+TEST(init_intl, initializes_recv_ring)
 {
     Fixture f;
     unsigned const frame_len = arq__frame_len(f.arq.cfg.segment_length_in_bytes);
-    mock().expectOneCall("arq__recv_frame_init").withParameter("f", &f.arq.recv_frame)
+    mock().expectOneCall("arq__recv_ring_init").withParameter("r", &f.arq.recv_ring)
+                                               .withParameter("cap", f.arq.cfg.recv_ring_size_in_frames)
+                                               .withParameter("frame_cap", frame_len);
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+}
+
+TEST(init_intl, zero_ring_sizes_mean_one_frame)
+{
+    Fixture f;
+    f.arq.cfg.recv_ring_size_in_frames = 0;
+    f.arq.cfg.send_ring_size_in_frames = 0;
+    unsigned const frame_len = arq__frame_len(f.arq.cfg.segment_length_in_bytes);
+    mock().expectOneCall("arq__send_frame_init").withParameter("f", &f.arq.send_frame)
                                                 .withParameter("cap", frame_len);
+    mock().expectOneCall("arq__recv_ring_init").withParameter("r", &f.arq.recv_ring)
+                                               .withParameter("cap", 1u)
+                                               .withParameter("frame_cap", frame_len);
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(1u, f.arq.cfg.recv_ring_size_in_frames);
+    CHECK_EQUAL(1u, f.arq.cfg.send_ring_size_in_frames);
+}
+
+TEST(init_intl, copies_retransmission_timeouts_into_send_window)
+{
+    Fixture f;
+    f.arq.cfg.retransmission_timeout = 100;
+    f.arq.cfg.retransmission_timeout_max = 1000;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(100, f.arq.send_wnd.rto_min);
+    CHECK_EQUAL(1000, f.arq.send_wnd.rto_max);
+}
+
+TEST(init_intl, zero_retransmission_timeout_max_fixes_the_timeout)
+{
+    Fixture f;
+    f.arq.cfg.retransmission_timeout = 100;
+    f.arq.cfg.retransmission_timeout_max = 0;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(100, f.arq.send_wnd.rto_min);
+    CHECK_EQUAL(100, f.arq.send_wnd.rto_max);
+}
+
+TEST(init_intl, initializes_pacer_with_scaled_burst)
+{
+    Fixture f;
+    f.arq.cfg.pacing_rate_in_bytes_per_sec = 11520;
+    f.arq.cfg.pacing_burst_in_bytes = 256;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(11520u, f.arq.pacer.rate);
+    CHECK_EQUAL(1000u, f.arq.pacer.scale);
+    CHECK_EQUAL(256000u, f.arq.pacer.cap);
+}
+
+TEST(init_intl, scales_pacer_tokens_by_ticks_per_sec)
+{
+    Fixture f;
+    f.arq.cfg.pacing_rate_in_bytes_per_sec = 11520;
+    f.arq.cfg.pacing_burst_in_bytes = 256;
+    f.arq.cfg.pacing_ticks_per_sec = 10000;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(10000u, f.arq.pacer.scale);
+    CHECK_EQUAL(2560000u, f.arq.pacer.cap);
+}
+
+TEST(init_intl, leaves_pacer_disabled_without_rate)
+{
+    Fixture f;
+    f.arq.cfg.pacing_burst_in_bytes = 256;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL(0u, f.arq.pacer.rate);
+    CHECK_EQUAL(0u, f.arq.pacer.cap);
+}
+
+TEST(init_intl, hands_congestion_user_context_to_send_window)
+{
+    Fixture f;
+    int ctx;
+    f.arq.cfg.congestion = nullptr;
+    f.arq.cfg.congestion_user = &ctx;
+    mock().ignoreOtherCalls();
+    arq__init(&f.arq);
+    CHECK_EQUAL((void *)&ctx, f.arq.send_wnd.cc.user);
+}
+
+TEST(init_intl, copies_ack_delay_into_recv_window)
+{
+    Fixture f;
+    f.arq.cfg.ack_delay = 25;
     mock().ignoreOtherCalls();
     arq__init(&f.arq);
+    CHECK_EQUAL(25, f.arq.recv_wnd.ack_delay_max);
 }
 
 }
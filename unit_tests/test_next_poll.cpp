@@ -20,19 +20,39 @@ struct Fixture
 {
     Fixture()
     {
+        sw.w.msg = msg.data();
         sw.rtx = rtx.data();
+        sw.tmr = tmr.data();
+        sw.tmr_pos = tmr_pos.data();
+        sw.rdy = rdy.data();
+        sw.sent = sent.data();
+        sw.tx = tx.data();
         std::memset(rtx.data(), 0, sizeof(arq_time_t) * rtx.size());
+        std::memset(tmr_pos.data(), 0, sizeof(arq_uint16_t) * tmr_pos.size());
+        std::memset(msg.data(), 0, sizeof(arq__msg_t) * msg.size());
+        std::memset(rdy.data(), 0, sizeof(arq_uint32_t) * rdy.size());
+        std::memset(tx.data(), 0, tx.size());
+        sw.tmr_len = 0;
+        sw.now = 0;
         sw.w.cap = (arq_uint16_t)rtx.size();
         sw.w.size = 0;
         sw.w.seq = 0;
         sw.tiny_on = ARQ_FALSE;
+        sw.probe_on = ARQ_FALSE;
         rw.inter_seg_ack_on = ARQ_FALSE;
         rw.inter_seg_ack_seq = 0;
+        rw.ack_delay_on = ARQ_FALSE;
         conn.state = ARQ_CONN_STATE_CLOSED;
         conn.u.rst_sent.tmr = ARQ_TIME_INFINITY;
     };
     arq__send_wnd_t sw;
+    std::array< arq__msg_t, 16 > msg;
     std::array< arq_time_t, 16 > rtx;
+    std::array< arq_time_t, 16 > sent;
+    std::array< arq_uchar_t, 16 > tx;
+    std::array< arq_uint16_t, 16 > tmr;
+    std::array< arq_uint16_t, 16 > tmr_pos;
+    std::array< arq_uint32_t, 1 > rdy;
     arq__recv_wnd_t rw;
     arq__conn_t conn;
 };
@@ -48,7 +68,7 @@ TEST(next_poll, returns_only_rtx_timer)
 {
     Fixture f;
     f.sw.w.size = 1;
-    f.rtx[0] = 13;
+    arq__send_wnd_tmr_set(&f.sw, 0, 13);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(13, t);
 }
@@ -58,7 +78,7 @@ TEST(next_poll, returns_smallest_rtx_timer)
     Fixture f;
     f.sw.w.size = 14;
     for (auto i = 0u; i < f.sw.w.size; ++i) {
-        f.rtx[i] = 14 - i;
+        arq__send_wnd_tmr_set(&f.sw, i, 14 - i);
     }
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(1, t);
@@ -69,12 +89,12 @@ TEST(next_poll, looks_at_rtx_timers_inside_of_active_send_window)
     Fixture f;
     f.sw.w.size = (arq_uint16_t)f.rtx.size();
     for (auto i = 0u; i < f.sw.w.size; ++i) {
-        f.rtx[i] = 2;
+        arq__send_wnd_tmr_set(&f.sw, i, 2);
     }
     f.sw.w.seq = 5;
     f.sw.w.size = 2;
-    f.rtx[5] = 0;
-    f.rtx[6] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 5, 0);
+    arq__send_wnd_tmr_set(&f.sw, 6, 1);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(1, t);
 }
@@ -83,7 +103,7 @@ TEST(next_poll, doesnt_return_expired_rtx_timers)
 {
     Fixture f;
     f.sw.w.size = 10;
-    f.rtx[7] = 123;
+    arq__send_wnd_tmr_set(&f.sw, 7, 123);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(123, t);
 }
@@ -97,13 +117,22 @@ TEST(next_poll, returns_tinygram_expiry_time_if_tinygram_timer_on)
     CHECK_EQUAL(93, t);
 }
 
+TEST(next_poll, returns_zero_window_probe_time_if_probe_timer_on)
+{
+    Fixture f;
+    f.sw.probe_on = ARQ_TRUE;
+    f.sw.probe = 71;
+    arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
+    CHECK_EQUAL(71, t);
+}
+
 TEST(next_poll, returns_tinygram_if_smaller_than_rtx)
 {
     Fixture f;
     f.sw.tiny_on = ARQ_TRUE;
     f.sw.tiny = 100;
     f.sw.w.size = 1;
-    f.rtx[0] = 101;
+    arq__send_wnd_tmr_set(&f.sw, 0, 101);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(100, t);
 }
@@ -114,7 +143,7 @@ TEST(next_poll, returns_smallest_rtx_if_tinygram_timer_on_but_larger_than_rtx)
     f.sw.tiny_on = ARQ_TRUE;
     f.sw.tiny = 100;
     f.sw.w.size = 1;
-    f.rtx[0] = 99;
+    arq__send_wnd_tmr_set(&f.sw, 0, 99);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(99, t);
 }
@@ -123,7 +152,7 @@ TEST(next_poll, returns_rtx_timer_if_smaller_than_ack_seg_timer)
 {
     Fixture f;
     f.sw.w.size = 1;
-    f.rtx[0] = 123;
+    arq__send_wnd_tmr_set(&f.sw, 0, 123);
     f.rw.inter_seg_ack_on = ARQ_TRUE;
     f.rw.inter_seg_ack = 200;
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
@@ -156,11 +185,31 @@ TEST(next_poll, returns_ack_seg_timer_if_smaller_than_rtx_timer)
     f.rw.inter_seg_ack_on = ARQ_TRUE;
     f.rw.inter_seg_ack = 10;
     f.sw.w.size = 1;
-    f.rtx[0] = 100;
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
     arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
     CHECK_EQUAL(10, t);
 }
 
+TEST(next_poll, returns_ack_delay_if_ack_delay_timer_on)
+{
+    Fixture f;
+    f.rw.ack_delay_on = ARQ_TRUE;
+    f.rw.ack_delay = 17;
+    f.rw.inter_seg_ack_on = ARQ_TRUE;
+    f.rw.inter_seg_ack = 40;
+    arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
+    CHECK_EQUAL(17, t);
+}
+
+TEST(next_poll, ignores_expired_ack_delay_timer)
+{
+    Fixture f;
+    f.rw.ack_delay_on = ARQ_TRUE;
+    f.rw.ack_delay = 0;
+    arq_time_t const t = arq__next_poll(&f.sw, &f.rw, &f.conn);
+    CHECK_EQUAL(ARQ_TIME_INFINITY, t);
+}
+
 TEST(next_poll, calls_conn_next_poll)
 {
     Fixture f;
@@ -0,0 +1,121 @@
+#include "arq_in_unit_tests.h"
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(pacer) {};
+
+namespace {
+
+struct Fixture
+{
+    Fixture()
+    {
+        p.rate = 1000;
+        p.scale = 1000;
+        p.cap = 100 * 1000;
+        p.tokens = 0;
+    }
+    arq__pacer_t p;
+};
+
+TEST(pacer, rst_fills_bucket)
+{
+    Fixture f;
+    arq__pacer_rst(&f.p);
+    CHECK_EQUAL(f.p.cap, f.p.tokens);
+}
+
+TEST(pacer, step_adds_elapsed_time_times_rate)
+{
+    Fixture f;
+    arq__pacer_step(&f.p, 7);
+    CHECK_EQUAL(7000u, f.p.tokens);
+}
+
+TEST(pacer, step_saturates_at_cap)
+{
+    Fixture f;
+    f.p.tokens = 99 * 1000;
+    arq__pacer_step(&f.p, 2);
+    CHECK_EQUAL(f.p.cap, f.p.tokens);
+}
+
+TEST(pacer, step_doesnt_overflow_with_huge_elapsed_time)
+{
+    Fixture f;
+    arq__pacer_step(&f.p, ARQ_TIME_INFINITY);
+    CHECK_EQUAL(f.p.cap, f.p.tokens);
+}
+
+TEST(pacer, step_is_a_no_op_without_rate)
+{
+    Fixture f;
+    f.p.rate = 0;
+    arq__pacer_step(&f.p, 10);
+    CHECK_EQUAL(0u, f.p.tokens);
+}
+
+TEST(pacer, ready_when_tokens_cover_len)
+{
+    Fixture f;
+    f.p.tokens = 10 * 1000;
+    CHECK_EQUAL(ARQ_TRUE, arq__pacer_ready(&f.p, 10));
+    CHECK_EQUAL(ARQ_FALSE, arq__pacer_ready(&f.p, 11));
+}
+
+TEST(pacer, always_ready_without_rate)
+{
+    Fixture f;
+    f.p.rate = 0;
+    CHECK_EQUAL(ARQ_TRUE, arq__pacer_ready(&f.p, 100));
+}
+
+TEST(pacer, spend_removes_len_in_tokens)
+{
+    Fixture f;
+    f.p.tokens = 10 * 1000;
+    arq__pacer_spend(&f.p, 4);
+    CHECK_EQUAL(6000u, f.p.tokens);
+}
+
+TEST(pacer, spend_saturates_at_zero)
+{
+    Fixture f;
+    f.p.tokens = 3 * 1000;
+    arq__pacer_spend(&f.p, 4);
+    CHECK_EQUAL(0u, f.p.tokens);
+}
+
+TEST(pacer, next_is_zero_when_ready)
+{
+    Fixture f;
+    f.p.tokens = 10 * 1000;
+    CHECK_EQUAL(0u, arq__pacer_next(&f.p, 10));
+}
+
+TEST(pacer, next_is_time_until_tokens_cover_len)
+{
+    Fixture f;
+    f.p.tokens = 4 * 1000;
+    CHECK_EQUAL(6u, arq__pacer_next(&f.p, 10));
+}
+
+TEST(pacer, ready_and_spend_scale_len_by_tokens_per_byte)
+{
+    Fixture f;
+    f.p.scale = 10;
+    f.p.tokens = 100;
+    CHECK_EQUAL(ARQ_TRUE, arq__pacer_ready(&f.p, 10));
+    CHECK_EQUAL(ARQ_FALSE, arq__pacer_ready(&f.p, 11));
+    arq__pacer_spend(&f.p, 4);
+    CHECK_EQUAL(60u, f.p.tokens);
+}
+
+TEST(pacer, next_rounds_up)
+{
+    Fixture f;
+    f.p.rate = 3000;
+    CHECK_EQUAL(4u, arq__pacer_next(&f.p, 10));
+}
+
+}
+
@@ -0,0 +1,30 @@
+#include "arq_in_unit_tests.h"
+#include <CppUTest/TestHarness.h>
+#include <limits>
+
+TEST_GROUP(pow2) {};
+
+namespace
+{
+
+TEST(pow2, zero_is_not_a_power_of_two)
+{
+    CHECK_EQUAL(ARQ_FALSE, arq__is_pow2(0));
+}
+
+TEST(pow2, single_bits_are_powers_of_two)
+{
+    for (auto i = 0u; i < sizeof(unsigned) * 8; ++i) {
+        CHECK_EQUAL(ARQ_TRUE, arq__is_pow2(1u << i));
+    }
+}
+
+TEST(pow2, multiple_bits_are_not_powers_of_two)
+{
+    CHECK_EQUAL(ARQ_FALSE, arq__is_pow2(3));
+    CHECK_EQUAL(ARQ_FALSE, arq__is_pow2(12));
+    CHECK_EQUAL(ARQ_FALSE, arq__is_pow2(std::numeric_limits< unsigned >::max()));
+}
+
+}
+
@@ -72,5 +72,87 @@ TEST(recv, returns_success)
     CHECK_EQUAL(ARQ_OK_COMPLETED, rv);
 }
 
+TEST(recv, peek_invalid_params)
+{
+    void const *p;
+    unsigned size;
+    arq_t arq;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_recv_peek(nullptr, &p, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_recv_peek(&arq, nullptr, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_recv_peek(&arq, &p, nullptr));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_recv_consume(nullptr, 1));
+}
+
+unsigned MockRecvWndPeek(arq__recv_wnd_t const *rw, void const **out_buf)
+{
+    return mock().actualCall("arq__recv_wnd_peek").withParameter("rw", rw)
+                                                  .withOutputParameter("out_buf", out_buf)
+                                                  .returnUnsignedIntValue();
+}
+
+void MockRecvWndConsume(arq__recv_wnd_t *rw, unsigned len)
+{
+    mock().actualCall("arq__recv_wnd_consume").withParameter("rw", rw).withParameter("len", len);
+}
+
+struct PeekFixture : Fixture
+{
+    PeekFixture()
+    {
+        ARQ_MOCK_HOOK(arq__recv_wnd_peek, MockRecvWndPeek);
+        ARQ_MOCK_HOOK(arq__recv_wnd_consume, MockRecvWndConsume);
+    }
+    void const *p = recv;
+};
+
+TEST(recv, peek_need_poll)
+{
+    PeekFixture f;
+    f.arq.need_poll = ARQ_TRUE;
+    void const *p;
+    unsigned size;
+    CHECK_EQUAL(ARQ_ERR_POLL_REQUIRED, arq_recv_peek(&f.arq, &p, &size));
+}
+
+TEST(recv, peek_returns_span_from_wnd_peek)
+{
+    PeekFixture f;
+    mock().expectOneCall("arq__recv_wnd_peek").withParameter("rw", &f.arq.recv_wnd)
+                                              .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+                                              .andReturnValue(7u);
+    void const *p = nullptr;
+    unsigned size;
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_recv_peek(&f.arq, &p, &size));
+    POINTERS_EQUAL(f.recv, p);
+    CHECK_EQUAL(7u, size);
+}
+
+TEST(recv, consume_need_poll)
+{
+    PeekFixture f;
+    f.arq.need_poll = ARQ_TRUE;
+    mock().expectNoCall("arq__recv_wnd_consume");
+    CHECK_EQUAL(ARQ_ERR_POLL_REQUIRED, arq_recv_consume(&f.arq, 0));
+}
+
+TEST(recv, consume_calls_wnd_consume)
+{
+    PeekFixture f;
+    mock().expectOneCall("arq__recv_wnd_peek").withParameter("rw", &f.arq.recv_wnd)
+                                              .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+                                              .andReturnValue(7u);
+    mock().expectOneCall("arq__recv_wnd_consume").withParameter("rw", &f.arq.recv_wnd).withParameter("len", 7u);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_recv_consume(&f.arq, 7));
+}
+
+TEST(recv, consume_more_than_peekable_is_invalid)
+{
+    PeekFixture f;
+    mock().expectOneCall("arq__recv_wnd_peek").withParameter("rw", &f.arq.recv_wnd)
+                                              .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+                                              .andReturnValue(7u);
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_recv_consume(&f.arq, 8));
+}
+
 }
 
@@ -231,5 +231,22 @@ TEST(recv_frame, fill_returns_index_of_first_zero_found_when_payload_contains_ze
     CHECK_EQUAL(32, written);
 }
 
+TEST(recv_frame, fill_stops_after_first_zero_at_any_position_in_long_payload)
+{
+    for (auto z = 0u; z < Fixture::BUFSIZE; ++z) {
+        Fixture f;
+        f.fill.assign(Fixture::BUFSIZE + 10, 0x5A);
+        f.fill[z] = 0;
+        f.fill[Fixture::BUFSIZE - 1] = 0;
+        unsigned const written = arq__recv_frame_fill(&f.f, f.fill.data(), f.fill.size());
+        CHECK_EQUAL(z + 1, written);
+        CHECK_EQUAL(z + 1, f.f.len);
+        CHECK_EQUAL(ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT, f.f.state);
+        MEMCMP_EQUAL(f.fill.data(), f.buf.data(), z + 1);
+        if (z + 1 < Fixture::BUFSIZE) {
+            CHECK_EQUAL(0xFF, f.buf[z + 1]);
+        }
+    }
 }
 
+}
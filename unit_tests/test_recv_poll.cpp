@@ -49,14 +49,30 @@ unsigned MockRecvWndFrame(arq__recv_wnd_t *rw,
                                                    .returnUnsignedIntValue();
 }
 
-arq_bool_t MockRecvWndAck(arq__recv_wnd_t const *rw, unsigned *out_ack_seq, arq_uint16_t* out_ack_vec)
+arq_bool_t MockRecvWndAck(arq__recv_wnd_t *rw, unsigned *out_ack_seq, arq_uint16_t* out_ack_vec)
 {
-    return (arq_bool_t)mock().actualCall("arq__recv_wnd_ack").withParameter("rw", rw)
+    return (arq_bool_t)mock().actualCall("arq__recv_wnd_ack").withParameter("rw", (void const *)rw)
                                                              .withOutputParameter("out_ack_seq", out_ack_seq)
                                                              .withOutputParameter("out_ack_vec", out_ack_vec)
                                                              .returnIntValue();
 }
 
+unsigned MockRecvWndSack(arq__recv_wnd_t *rw, unsigned seq, void *out_blk, unsigned blk_max)
+{
+    return mock().actualCall("arq__recv_wnd_sack").withParameter("rw", rw)
+                                                  .withParameter("seq", seq)
+                                                  .withParameter("out_blk", out_blk)
+                                                  .withParameter("blk_max", blk_max)
+                                                  .returnUnsignedIntValue();
+}
+
+unsigned MockRecvWndAdv(arq__recv_wnd_t const *rw, unsigned seq)
+{
+    return mock().actualCall("arq__recv_wnd_adv").withParameter("rw", rw)
+                                                 .withParameter("seq", seq)
+                                                 .returnUnsignedIntValue();
+}
+
 struct Fixture
 {
     Fixture()
@@ -65,15 +81,32 @@ struct Fixture
         ARQ_MOCK_HOOK(arq__frame_read, MockFrameRead);
         ARQ_MOCK_HOOK(arq__recv_wnd_frame, MockRecvWndFrame);
         ARQ_MOCK_HOOK(arq__recv_wnd_ack, MockRecvWndAck);
-        arq.recv_frame.buf = &dummy;
+        ARQ_MOCK_HOOK(arq__recv_wnd_sack, MockRecvWndSack);
+        ARQ_MOCK_HOOK(arq__recv_wnd_adv, MockRecvWndAdv);
+        rf.buf = &dummy;
         arq__frame_hdr_init(&sh);
         arq__frame_hdr_init(&rh);
         arq.recv_wnd.w.cap = 8;
+        arq.recv_wnd.w.seg_len = 32;
         arq.recv_wnd.ack = ack.data();
-        std::memset(ack.data(), 0, ack.size());
+        arq.recv_wnd.sack = sack.data();
+        arq.recv_wnd.adv = ARQ_FALSE;
+        arq.recv_wnd.adv_end = ARQ__FRAME_MAX_SEQ_NUM; // nothing the mocked window adds up to
+        arq.recv_wnd.adv_prev_end = ARQ__FRAME_MAX_SEQ_NUM;
+        arq.recv_wnd.adv_repeat = ARQ_FALSE;
+        arq.recv_wnd.copy_seq = 0;
+        arq.recv_wnd.w.seq = 0;
+        arq.recv_wnd.w.size = 0;
+        arq.recv_wnd.inter_seg_ack_on = ARQ_FALSE;
+        arq.recv_wnd.ack_delay_max = 0;
+        arq.recv_wnd.ack_delay_on = ARQ_FALSE;
+        arq.recv_wnd.ack_saved = 0;
+        std::memset(ack.data(), 0, sizeof(arq_uint32_t) * ack.size());
     }
     arq_t arq;
-    std::array< arq_bool_t, 8 > ack;
+    arq__recv_frame_t rf;
+    std::array< arq_uint32_t, 1 > ack;
+    std::array< arq_uchar_t, 32 > sack;
     arq__frame_hdr_t sh, rh;
     arq_uchar_t dummy;
 };
@@ -81,31 +114,31 @@ struct Fixture
 TEST(recv_poll, calls_frame_read_if_recv_frame_has_a_full_frame)
 {
     Fixture f;
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
-    f.arq.recv_frame.len = 123;
-    mock().expectOneCall("arq__frame_read").withParameter("frame", f.arq.recv_frame.buf)
-                                           .withParameter("frame_len", f.arq.recv_frame.len)
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rf.len = 123;
+    mock().expectOneCall("arq__frame_read").withParameter("frame", f.rf.buf)
+                                           .withParameter("frame_len", f.rf.len)
                                            .withParameter("checksum", (void *)csum)
                                            .ignoreOtherParameters();
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
 }
 
 TEST(recv_poll, resets_recv_frame_after_frame_read)
 {
     Fixture f;
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
-    f.arq.recv_frame.len = 123;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rf.len = 123;
     mock().expectOneCall("arq__frame_read").ignoreOtherParameters();
-    mock().expectOneCall("arq__recv_frame_rst").withParameter("f", &f.arq.recv_frame);
+    mock().expectOneCall("arq__recv_frame_rst").withParameter("f", &f.rf);
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
 }
 
 TEST(recv_poll, calls_recv_wnd_frame_if_frame_read_returns_success)
 {
     Fixture f;
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
     f.arq.cfg.inter_segment_timeout = 1234;
     f.rh.seg = 1;
     f.rh.seq_num = 2;
@@ -123,20 +156,113 @@ TEST(recv_poll, calls_recv_wnd_frame_if_frame_read_returns_success)
                                                .withParameter("inter_seg_ack", f.arq.cfg.inter_segment_timeout)
                                                .ignoreOtherParameters();
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, f.arq.cfg.inter_segment_timeout);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, f.arq.cfg.inter_segment_timeout);
+}
+
+TEST(recv_poll, widens_seq_num_of_var_header_frame_around_recv_window)
+{
+    Fixture f;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.arq.recv_wnd.w.seq = 0x3FE;
+    f.rh.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    f.rh.seg = 1;
+    f.rh.seq_num = 0x01;
+    f.rh.msg_len = 1;
+    f.rh.seg_len = 16;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().expectOneCall("arq__recv_wnd_frame").withParameter("seq", 0x401)
+                                               .ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+}
+
+TEST(recv_poll, drops_var_header_frame_with_segment_longer_than_window_segment)
+{
+    Fixture f;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rh.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    f.rh.seg = 1;
+    f.rh.ack = 1;
+    f.rh.msg_len = 1;
+    f.rh.seg_len = f.arq.recv_wnd.w.seg_len + 1;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().expectNoCall("arq__recv_wnd_frame");
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(ARQ_FALSE, f.rh.seg);
+    CHECK_EQUAL(ARQ_FALSE, f.rh.ack);
+}
+
+TEST(recv_poll, drops_var_header_frame_with_segment_if_recv_window_is_over_var_max_window)
+{
+    Fixture f;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.arq.recv_wnd.w.cap = ARQ__FRAME_VAR_MAX_WINDOW + 1;
+    f.rh.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    f.rh.seg = 1;
+    f.rh.msg_len = 1;
+    f.rh.seg_len = 16;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().expectNoCall("arq__recv_wnd_frame");
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(ARQ_FALSE, f.rh.seg);
+}
+
+TEST(recv_poll, accepts_var_header_ack_frame_if_recv_window_is_over_var_max_window)
+{
+    Fixture f;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.arq.recv_wnd.w.cap = ARQ__FRAME_VAR_MAX_WINDOW + 1;
+    f.rh.version = ARQ__FRAME_VERSION_LAYOUT_VAR;
+    f.rh.ack = 1;
+    f.rh.ack_num = 12;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(ARQ_TRUE, f.rh.ack);
+    CHECK_EQUAL(12, f.rh.ack_num);
 }
 
 TEST(recv_poll, doesnt_call_recv_wnd_frame_if_frame_has_no_segment)
 {
     Fixture f;
-    f.arq.recv_frame.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
     mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
                                            .ignoreOtherParameters()
                                            .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
     mock().expectOneCall("arq__recv_frame_rst").ignoreOtherParameters();
     mock().expectOneCall("arq__recv_wnd_ack").withParameter("rw", (void const *)&f.arq.recv_wnd)
                                              .ignoreOtherParameters();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    mock().expectOneCall("arq__recv_wnd_adv").ignoreOtherParameters();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+}
+
+TEST(recv_poll, clears_recv_header_if_frame_read_fails)
+{
+    Fixture f;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    arq__frame_hdr_t bad_hdr = f.rh;
+    bad_hdr.ack = ARQ_TRUE;
+    bad_hdr.seg = ARQ_TRUE;
+    bad_hdr.ack_num = 12;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &bad_hdr, sizeof(bad_hdr))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_ERR_VERSION);
+    mock().expectNoCall("arq__recv_wnd_frame");
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(ARQ_FALSE, f.rh.ack);
+    CHECK_EQUAL(ARQ_FALSE, f.rh.seg);
+    CHECK_EQUAL(0, f.rh.ack_num);
 }
 
 TEST(recv_poll, doesnt_touch_inter_seg_ack_timer_if_timer_is_off)
@@ -145,7 +271,7 @@ TEST(recv_poll, doesnt_touch_inter_seg_ack_timer_if_timer_is_off)
     f.arq.recv_wnd.inter_seg_ack_on = ARQ_FALSE;
     f.arq.recv_wnd.inter_seg_ack = 123;
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 15, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 15, 0);
     CHECK_EQUAL(123, f.arq.recv_wnd.inter_seg_ack);
 }
 
@@ -155,7 +281,7 @@ TEST(recv_poll, steps_inter_seg_ack_timer_by_dt_if_timer_is_on)
     f.arq.recv_wnd.inter_seg_ack_on = ARQ_TRUE;
     f.arq.recv_wnd.inter_seg_ack = 123;
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 15, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 15, 0);
     CHECK_EQUAL(123 - 15, f.arq.recv_wnd.inter_seg_ack);
 }
 
@@ -165,7 +291,7 @@ TEST(recv_poll, disables_inter_seg_ack_timer_if_expires)
     f.arq.recv_wnd.inter_seg_ack_on = ARQ_TRUE;
     f.arq.recv_wnd.inter_seg_ack = 123;
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 123, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 123, 0);
     CHECK_EQUAL(0, f.arq.recv_wnd.inter_seg_ack);
     CHECK_EQUAL(ARQ_FALSE, f.arq.recv_wnd.inter_seg_ack_on);
 }
@@ -177,8 +303,8 @@ TEST(recv_poll, sets_ack_entry_for_inter_seg_ack_seq_if_timer_expires)
     f.arq.recv_wnd.inter_seg_ack = 123;
     f.arq.recv_wnd.inter_seg_ack_seq = 234;
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 123, 0);
-    CHECK_EQUAL(1, f.arq.recv_wnd.ack[234 % f.arq.recv_wnd.w.cap]);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 123, 0);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.arq.recv_wnd.ack, 234 % f.arq.recv_wnd.w.cap));
 }
 
 TEST(recv_poll, result_of_ack_is_written_into_send_header)
@@ -192,17 +318,195 @@ TEST(recv_poll, result_of_ack_is_written_into_send_header)
           .withOutputParameterReturning("out_ack_vec", &ack_vec, sizeof(ack_vec))
           .andReturnValue(1);
     mock().ignoreOtherCalls();
-    arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
     CHECK_EQUAL(ack_seq, f.sh.ack_num);
     CHECK_EQUAL(ack_vec, f.sh.cur_ack_vec);
     CHECK(f.sh.ack);
 }
 
+TEST(recv_poll, builds_sack_block_after_acked_seq_if_ack_call_returns_one)
+{
+    Fixture f;
+    unsigned ack_seq = 12;
+    mock().expectOneCall("arq__recv_wnd_ack")
+          .withParameter("rw", (void const *)&f.arq.recv_wnd)
+          .withOutputParameterReturning("out_ack_seq", &ack_seq, sizeof(ack_seq))
+          .ignoreOtherParameters()
+          .andReturnValue(1);
+    mock().expectOneCall("arq__recv_wnd_sack").withParameter("rw", &f.arq.recv_wnd)
+                                              .withParameter("seq", ack_seq)
+                                              .withParameter("out_blk", (void *)f.sack.data())
+                                              .withParameter("blk_max", 32u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+}
+
+TEST(recv_poll, sack_block_is_written_into_send_header_if_not_empty)
+{
+    Fixture f;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(1);
+    mock().expectOneCall("arq__recv_wnd_sack").ignoreOtherParameters().andReturnValue(5u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    POINTERS_EQUAL(f.sack.data(), f.sh.sack);
+    CHECK_EQUAL(5, f.sh.seg_len);
+    CHECK(!f.sh.seg);
+}
+
+TEST(recv_poll, send_header_has_no_sack_block_if_sack_is_empty)
+{
+    Fixture f;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(1);
+    mock().expectOneCall("arq__recv_wnd_sack").ignoreOtherParameters().andReturnValue(0u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    POINTERS_EQUAL(nullptr, f.sh.sack);
+    CHECK_EQUAL(0, f.sh.seg_len);
+}
+
+TEST(recv_poll, doesnt_build_sack_block_if_nothing_to_ack)
+{
+    Fixture f;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+    mock().expectNoCall("arq__recv_wnd_sack");
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    POINTERS_EQUAL(nullptr, f.sh.sack);
+}
+
+TEST(recv_poll, advertises_window_relative_to_acked_seq)
+{
+    Fixture f;
+    unsigned ack_seq = 12;
+    mock().expectOneCall("arq__recv_wnd_ack")
+          .withOutputParameterReturning("out_ack_seq", &ack_seq, sizeof(ack_seq))
+          .ignoreOtherParameters()
+          .andReturnValue(1);
+    mock().expectOneCall("arq__recv_wnd_sack").ignoreOtherParameters();
+    mock().expectOneCall("arq__recv_wnd_adv").withParameter("rw", (void const *)&f.arq.recv_wnd)
+                                             .withParameter("seq", ack_seq)
+                                             .andReturnValue(7u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.sh.win);
+    CHECK_EQUAL(7, f.sh.win_size);
+}
+
+TEST(recv_poll, advertises_window_relative_to_copy_seq_if_nothing_to_ack)
+{
+    Fixture f;
+    f.arq.recv_wnd.copy_seq = 33;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+    mock().expectOneCall("arq__recv_wnd_adv").withParameter("rw", (void const *)&f.arq.recv_wnd)
+                                             .withParameter("seq", 33u)
+                                             .andReturnValue(9u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(!f.sh.ack);
+    CHECK(f.sh.win);
+    CHECK_EQUAL(33, f.sh.ack_num);
+    CHECK_EQUAL(9, f.sh.win_size);
+}
+
+TEST(recv_poll, leaves_window_flag_clear_on_second_frame_if_window_hasnt_moved)
+{
+    Fixture f;
+    f.arq.recv_wnd.copy_seq = 33;
+    for (int i = 0; i < 2; ++i) {
+        mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+        mock().expectOneCall("arq__recv_wnd_adv").ignoreOtherParameters().andReturnValue(9u);
+    }
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.sh.win);
+    arq__recv_wnd_advertised(&f.arq.recv_wnd, f.sh.ack_num, f.sh.win_size);
+    arq__frame_hdr_init(&f.sh);
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(!f.sh.win);
+    CHECK_EQUAL(9, f.sh.win_size);
+}
+
+TEST(recv_poll, flags_window_that_moved_since_last_advertisement)
+{
+    Fixture f;
+    f.arq.recv_wnd.copy_seq = 33;
+    f.arq.recv_wnd.adv_end = 33 + 8;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+    mock().expectOneCall("arq__recv_wnd_adv").ignoreOtherParameters().andReturnValue(9u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.sh.win);
+}
+
+TEST(recv_poll, repeats_unmoved_window_if_peer_sends_past_the_previous_advertisement)
+{
+    Fixture f;
+    f.arq.recv_wnd.adv_prev_end = 2;
+    f.arq.recv_wnd.adv_end = 4;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rh.seg = 1;
+    f.rh.seq_num = 2;
+    f.rh.msg_len = 1;
+    f.rh.seg_len = 16;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().expectOneCall("arq__recv_wnd_adv").ignoreOtherParameters().andReturnValue(4u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.sh.win);
+    arq__recv_wnd_advertised(&f.arq.recv_wnd, f.sh.ack_num, f.sh.win_size);
+    CHECK(!f.arq.recv_wnd.adv_repeat);
+    CHECK_EQUAL(4, f.arq.recv_wnd.adv_prev_end);
+}
+
+TEST(recv_poll, doesnt_repeat_window_for_segments_before_the_previous_advertisement)
+{
+    Fixture f;
+    f.arq.recv_wnd.adv_prev_end = 4;
+    f.arq.recv_wnd.adv_end = 4;
+    f.rf.state = ARQ__RECV_FRAME_STATE_FULL_FRAME_PRESENT;
+    f.rh.seg = 1;
+    f.rh.seq_num = 3;
+    f.rh.msg_len = 1;
+    f.rh.seg_len = 16;
+    mock().expectOneCall("arq__frame_read").withOutputParameterReturning("out_hdr", &f.rh, sizeof(f.rh))
+                                           .ignoreOtherParameters()
+                                           .andReturnValue(ARQ__FRAME_READ_RESULT_SUCCESS);
+    mock().expectOneCall("arq__recv_wnd_adv").ignoreOtherParameters().andReturnValue(4u);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(!f.arq.recv_wnd.adv_repeat);
+    CHECK(!f.sh.win);
+}
+
+TEST(recv_poll, returns_one_if_window_update_is_pending)
+{
+    Fixture f;
+    f.arq.recv_wnd.adv = ARQ_TRUE;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+    mock().ignoreOtherCalls();
+    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(1, emit);
+}
+
+TEST(recv_poll, leaves_window_update_pending_until_frame_is_written)
+{
+    Fixture f;
+    f.arq.recv_wnd.adv = ARQ_TRUE;
+    f.arq.recv_wnd.adv_end = 5;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(0);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.arq.recv_wnd.adv);
+    CHECK_EQUAL(5, f.arq.recv_wnd.adv_end);
+}
+
 TEST(recv_poll, returns_zero_if_send_header_is_null)
 {
     Fixture f;
     mock().ignoreOtherCalls();
-    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, nullptr, &f.rh, 0, 0);
+    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, nullptr, &f.rh, 0, 0);
     CHECK_EQUAL(0, emit);
 }
 
@@ -213,7 +517,7 @@ TEST(recv_poll, returns_one_if_ack_call_returns_one)
                                              .ignoreOtherParameters()
                                              .andReturnValue(1);
     mock().ignoreOtherCalls();
-    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
     CHECK_EQUAL(1, emit);
 }
 
@@ -224,9 +528,111 @@ TEST(recv_poll, returns_zero_if_ack_call_returns_zero)
                                              .ignoreOtherParameters()
                                              .andReturnValue(0);
     mock().ignoreOtherCalls();
-    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.arq.recv_frame, csum, &f.sh, &f.rh, 0, 0);
+    int const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
     CHECK_EQUAL(0, emit);
 }
 
+struct AckDelayFixture : Fixture
+{
+    AckDelayFixture()
+    {
+        arq.recv_wnd.ack_delay_max = 20;
+        arq.recv_wnd.w.size = 4;
+    }
+    void Complete(unsigned idx)
+    {
+        arq__bits_set(ack.data(), idx);
+    }
+};
+
+TEST(recv_poll, doesnt_start_ack_delay_timer_without_pending_acks)
+{
+    AckDelayFixture f;
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(!f.arq.recv_wnd.ack_delay_on);
+}
+
+TEST(recv_poll, starts_ack_delay_timer_when_an_ack_is_pending)
+{
+    AckDelayFixture f;
+    f.Complete(1);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 5, 0);
+    CHECK(f.arq.recv_wnd.ack_delay_on);
+    CHECK_EQUAL(20, f.arq.recv_wnd.ack_delay);
+}
+
+TEST(recv_poll, holds_ack_while_ack_delay_timer_runs)
+{
+    AckDelayFixture f;
+    f.Complete(1);
+    mock().expectNoCall("arq__recv_wnd_ack");
+    mock().ignoreOtherCalls();
+    arq_bool_t const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK_EQUAL(ARQ_FALSE, emit);
+    CHECK(!f.sh.ack);
+    CHECK(f.sh.win);
+}
+
+TEST(recv_poll, holds_ack_without_send_header)
+{
+    AckDelayFixture f;
+    f.Complete(1);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, nullptr, &f.rh, 0, 0);
+    CHECK(f.arq.recv_wnd.ack_delay_on);
+    CHECK(arq__bits_test(f.ack.data(), 1));
+}
+
+TEST(recv_poll, steps_ack_delay_timer_by_dt)
+{
+    AckDelayFixture f;
+    f.arq.recv_wnd.ack_delay_on = ARQ_TRUE;
+    f.arq.recv_wnd.ack_delay = 20;
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, nullptr, &f.rh, 8, 0);
+    CHECK_EQUAL(12, f.arq.recv_wnd.ack_delay);
+}
+
+TEST(recv_poll, sends_held_acks_once_ack_delay_expires)
+{
+    AckDelayFixture f;
+    f.Complete(1);
+    f.arq.recv_wnd.ack_delay_on = ARQ_TRUE;
+    f.arq.recv_wnd.ack_delay = 20;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(1);
+    mock().ignoreOtherCalls();
+    arq_bool_t const emit = arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 20, 0);
+    CHECK_EQUAL(ARQ_TRUE, emit);
+    CHECK(f.sh.ack);
+    CHECK(!f.arq.recv_wnd.ack_delay_on);
+}
+
+TEST(recv_poll, sends_held_acks_early_with_window_update)
+{
+    AckDelayFixture f;
+    f.Complete(1);
+    f.arq.recv_wnd.adv = ARQ_TRUE;
+    mock().expectOneCall("arq__recv_wnd_ack").ignoreOtherParameters().andReturnValue(1);
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 0, 0);
+    CHECK(f.sh.ack);
+}
+
+TEST(recv_poll, doesnt_count_acks_merged_into_one_delayed_frame_as_saved)
+{
+    AckDelayFixture f;
+    f.Complete(0);
+    f.Complete(1);
+    f.Complete(3);
+    f.arq.recv_wnd.ack_delay_on = ARQ_TRUE;
+    f.arq.recv_wnd.ack_delay = 1;
+    mock().ignoreOtherCalls();
+    arq__recv_poll(&f.arq.recv_wnd, &f.rf, csum, &f.sh, &f.rh, 1, 0);
+    CHECK_EQUAL(0u, f.arq.recv_wnd.ack_saved);
+    CHECK(!f.arq.recv_wnd.ack_delay_on);
+}
+
 }
 
@@ -0,0 +1,122 @@
+#include "arq_in_unit_tests.h"
+#include "arq_runtime_mock_plugin.h"
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+#include <array>
+#include <vector>
+
+TEST_GROUP(recv_ring) {};
+
+namespace {
+
+struct Fixture
+{
+    enum { FRAMES = 3, FRAME_CAP = 8 };
+    Fixture()
+    {
+        r.frame = frames.data();
+        r.buf = buf.data();
+        arq__recv_ring_init(&r, FRAMES, FRAME_CAP);
+        arq__recv_ring_rst(&r);
+    }
+    arq__recv_ring_t r;
+    std::array< arq__recv_frame_t, FRAMES > frames;
+    std::array< arq_uchar_t, FRAMES * FRAME_CAP > buf;
+};
+
+TEST(recv_ring, init_assigns_capacity)
+{
+    Fixture f;
+    CHECK_EQUAL((unsigned)Fixture::FRAMES, f.r.cap);
+}
+
+TEST(recv_ring, init_carves_frame_buffers_out_of_ring_buffer)
+{
+    Fixture f;
+    for (auto i = 0u; i < Fixture::FRAMES; ++i) {
+        POINTERS_EQUAL(&f.buf[i * Fixture::FRAME_CAP], f.frames[i].buf);
+        CHECK_EQUAL(Fixture::FRAME_CAP, f.frames[i].cap);
+    }
+}
+
+void MockRecvFrameRst(arq__recv_frame_t *rf)
+{
+    mock().actualCall("arq__recv_frame_rst").withParameter("f", rf);
+}
+
+TEST(recv_ring, rst_resets_every_frame_and_cursors)
+{
+    Fixture f;
+    f.r.rd = 2;
+    f.r.wr = 1;
+    ARQ_MOCK_HOOK(arq__recv_frame_rst, MockRecvFrameRst);
+    for (auto &rf : f.frames) {
+        mock().expectOneCall("arq__recv_frame_rst").withParameter("f", &rf);
+    }
+    arq__recv_ring_rst(&f.r);
+    CHECK_EQUAL(0u, f.r.rd);
+    CHECK_EQUAL(0u, f.r.wr);
+}
+
+TEST(recv_ring, pending_is_zero_after_rst)
+{
+    Fixture f;
+    CHECK_EQUAL(0u, arq__recv_ring_pending(&f.r));
+}
+
+TEST(recv_ring, fill_partial_frame_doesnt_advance_write_cursor)
+{
+    Fixture f;
+    arq_uchar_t const src[] = { 1, 2, 3 };
+    CHECK_EQUAL(sizeof(src), arq__recv_ring_fill(&f.r, src, sizeof(src)));
+    CHECK_EQUAL(0u, f.r.wr);
+    CHECK_EQUAL(0u, arq__recv_ring_pending(&f.r));
+}
+
+TEST(recv_ring, fill_splits_burst_into_consecutive_frames)
+{
+    Fixture f;
+    arq_uchar_t const src[] = { 1, 2, 0, 3, 0, 4, 5 };
+    CHECK_EQUAL(sizeof(src), arq__recv_ring_fill(&f.r, src, sizeof(src)));
+    CHECK_EQUAL(2u, arq__recv_ring_pending(&f.r));
+    CHECK_EQUAL(2u, f.r.wr);
+    CHECK_EQUAL(3, f.frames[0].len);
+    MEMCMP_EQUAL(&src[0], f.frames[0].buf, 3);
+    CHECK_EQUAL(2, f.frames[1].len);
+    MEMCMP_EQUAL(&src[3], f.frames[1].buf, 2);
+    CHECK_EQUAL(2, f.frames[2].len);
+    CHECK_EQUAL(ARQ__RECV_FRAME_STATE_ACCUMULATING, f.frames[2].state);
+}
+
+TEST(recv_ring, fill_stops_when_every_frame_is_full)
+{
+    Fixture f;
+    arq_uchar_t const src[] = { 1, 0, 2, 0, 3, 0, 4, 0 };
+    CHECK_EQUAL(6u, arq__recv_ring_fill(&f.r, src, sizeof(src)));
+    CHECK_EQUAL((unsigned)Fixture::FRAMES, arq__recv_ring_pending(&f.r));
+    CHECK_EQUAL(0u, arq__recv_ring_fill(&f.r, &src[6], 2));
+}
+
+TEST(recv_ring, pop_advances_read_cursor_and_wraps)
+{
+    Fixture f;
+    f.r.rd = Fixture::FRAMES - 1;
+    arq__recv_ring_pop(&f.r);
+    CHECK_EQUAL(0u, f.r.rd);
+}
+
+TEST(recv_ring, pending_counts_from_read_cursor_across_wrap)
+{
+    Fixture f;
+    arq_uchar_t const src[] = { 1, 0, 2, 0, 3, 0 };
+    arq__recv_ring_fill(&f.r, src, 4);
+    arq__recv_frame_rst(&f.frames[0]);
+    arq__recv_ring_pop(&f.r);
+    CHECK_EQUAL(1u, arq__recv_ring_pending(&f.r));
+    CHECK_EQUAL(2u, arq__recv_ring_fill(&f.r, &src[4], 2));
+    CHECK_EQUAL(0u, f.r.wr);
+    CHECK_EQUAL(2u, arq__recv_ring_pending(&f.r));
+}
+
+}
+
@@ -27,12 +27,12 @@ struct UninitializedFixture
         recv.resize(buf.size());
         std::fill(std::begin(buf), std::end(buf), 0xFE);
         std::fill(std::begin(recv), std::end(recv), 0xFE);
-        std::fill(std::begin(ack), std::end(ack), 0xFE);
+        std::fill(std::begin(ack), std::end(ack), 0xFEFEFEFEu);
     }
 
     arq__recv_wnd_t rw;
     std::array< arq__msg_t, 64 > msg;
-    std::array< arq_uchar_t, 64 > ack;
+    std::array< arq_uint32_t, 2 > ack;
     std::vector< arq_uchar_t > buf;
     std::vector< arq_uchar_t > seg;
     std::vector< arq_uchar_t > recv;
@@ -70,7 +70,7 @@ TEST(recv_wnd, rst_sets_slide_to_zero)
     CHECK_EQUAL(0, f.rw.slide);
 }
 
-TEST(recv_wnd, rst_clears_ack_array)
+TEST(recv_wnd, rst_clears_ack_bitmap)
 {
     UninitializedFixture f;
     ARQ_MOCK_HOOK(arq__wnd_rst, MockWndRst);
@@ -256,27 +256,27 @@ TEST(recv_wnd, frame_doesnt_set_ack_entry_for_first_segment_of_message_in_window
 {
     Fixture f;
     f.seg.resize(1);
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 0));
     arq__recv_wnd_frame(&f.rw, 0, 0, 2, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 0));
 }
 
 TEST(recv_wnd, frame_doesnt_set_ack_entry_for_internal_segment_of_message_in_window)
 {
     Fixture f;
     f.seg.resize(1);
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 0));
     arq__recv_wnd_frame(&f.rw, 0, 1, 3, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 0));
 }
 
 TEST(recv_wnd, frame_sets_ack_set_entry_to_true_if_last_segment_of_message_is_in_window)
 {
     Fixture f;
     f.seg.resize(1);
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 0));
     arq__recv_wnd_frame(&f.rw, 0, 6, 7, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_TRUE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, 0));
 }
 
 TEST(recv_wnd, frame_sets_ack_set_entry_to_one_if_last_segment_of_message_is_in_window_big_seq)
@@ -284,9 +284,9 @@ TEST(recv_wnd, frame_sets_ack_set_entry_to_one_if_last_segment_of_message_is_in_
     Fixture f;
     f.seg.resize(1);
     f.rw.w.seq = ARQ__FRAME_MAX_SEQ_NUM;
-    CHECK_EQUAL(ARQ_FALSE, f.rw.ack[f.rw.w.seq % f.rw.w.cap]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, f.rw.w.seq % f.rw.w.cap));
     arq__recv_wnd_frame(&f.rw, ARQ__FRAME_MAX_SEQ_NUM, 0, 1, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_TRUE, f.rw.ack[f.rw.w.seq % f.rw.w.cap]);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, f.rw.w.seq % f.rw.w.cap));
 }
 
 TEST(recv_wnd, frame_doesnt_slide_window_when_msg_arrives_and_window_can_grow_to_hold_it)
@@ -370,9 +370,9 @@ TEST(recv_wnd, frame_leaves_ack_set_entry_to_one_if_ack_is_already_noticed)
 {
     Fixture f;
     f.seg.resize(1);
-    f.rw.ack[0] = ARQ_TRUE;
+    arq__bits_set(f.rw.ack, 0);
     arq__recv_wnd_frame(&f.rw, 0, 0, 1, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_TRUE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, 0));
 }
 
 TEST(recv_wnd, frame_sets_ack_entry_if_already_received_segment_is_received)
@@ -381,9 +381,9 @@ TEST(recv_wnd, frame_sets_ack_entry_if_already_received_segment_is_received)
     f.seg.resize(1);
     f.rw.w.size = 1;
     f.rw.w.msg[0].cur_ack_vec = 1;
-    f.rw.ack[0] = ARQ_FALSE;
+    arq__bits_clr(f.rw.ack, 0);
     arq__recv_wnd_frame(&f.rw, 0, 0, 3, f.seg.data(), f.seg.size(), 0);
-    CHECK_EQUAL(ARQ_TRUE, f.rw.ack[0]);
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, 0));
 }
 
 TEST(recv_wnd, frame_doesnt_enable_inter_seg_ack_timer_when_single_segment_message_arrives)
@@ -722,6 +722,498 @@ TEST(recv_wnd, recv_one_full_msg_one_tinygram_one_full_msg)
     }
 }
 
+TEST(recv_wnd, ack_returns_false_if_no_message_needs_ack)
+{
+    Fixture f;
+    f.rw.w.size = 3;
+    unsigned seq;
+    arq_uint16_t vec;
+    CHECK_EQUAL(ARQ_FALSE, arq__recv_wnd_ack(&f.rw, &seq, &vec));
+}
+
+TEST(recv_wnd, ack_returns_first_flagged_message_and_clears_its_bit)
+{
+    Fixture f;
+    f.rw.w.size = 40;
+    f.msg[35].cur_ack_vec = 0b11;
+    arq__bits_set(f.rw.ack, 35);
+    arq__bits_set(f.rw.ack, 37);
+    unsigned seq;
+    arq_uint16_t vec;
+    CHECK_EQUAL(ARQ_TRUE, arq__recv_wnd_ack(&f.rw, &seq, &vec));
+    CHECK_EQUAL(35u, seq);
+    CHECK_EQUAL(0b11, vec);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 35));
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, 37));
+}
+
+TEST(recv_wnd, ack_searches_from_window_start_and_wraps)
+{
+    Fixture f;
+    f.rw.w.seq = (arq_uint16_t)(f.rw.w.cap - 2);
+    f.rw.w.size = 4;
+    arq__bits_set(f.rw.ack, 1);
+    arq__bits_set(f.rw.ack, 5);
+    unsigned seq;
+    arq_uint16_t vec;
+    CHECK_EQUAL(ARQ_TRUE, arq__recv_wnd_ack(&f.rw, &seq, &vec));
+    CHECK_EQUAL(f.rw.w.cap + 1u, seq);
+}
+
+TEST(recv_wnd, ack_ignores_flagged_messages_outside_of_window)
+{
+    Fixture f;
+    f.rw.w.seq = 2;
+    f.rw.w.size = 2;
+    arq__bits_set(f.rw.ack, 0);
+    arq__bits_set(f.rw.ack, 4);
+    unsigned seq;
+    arq_uint16_t vec;
+    CHECK_EQUAL(ARQ_FALSE, arq__recv_wnd_ack(&f.rw, &seq, &vec));
+}
+
+TEST(recv_wnd, sack_returns_zero_if_no_later_message_has_anything_to_report)
+{
+    Fixture f;
+    f.rw.w.size = 3;
+    f.msg[0].cur_ack_vec = f.msg[0].full_ack_vec;
+    std::array< arq_uchar_t, 32 > blk;
+    CHECK_EQUAL(0u, arq__recv_wnd_sack(&f.rw, 0, blk.data(), blk.size()));
+}
+
+TEST(recv_wnd, sack_returns_zero_if_seq_is_outside_of_window)
+{
+    Fixture f;
+    f.rw.w.size = 3;
+    std::array< arq_uchar_t, 32 > blk;
+    CHECK_EQUAL(0u, arq__recv_wnd_sack(&f.rw, 3, blk.data(), blk.size()));
+}
+
+TEST(recv_wnd, sack_reports_complete_messages_after_seq_and_clears_their_bits)
+{
+    Fixture f;
+    f.rw.w.size = 10;
+    f.msg[3].cur_ack_vec = f.msg[3].full_ack_vec;
+    f.msg[5].cur_ack_vec = f.msg[5].full_ack_vec;
+    arq__bits_set(f.rw.ack, 5);
+    std::array< arq_uchar_t, 32 > blk;
+    CHECK_EQUAL(3u, arq__recv_wnd_sack(&f.rw, 2, blk.data(), blk.size()));
+    CHECK_EQUAL(3, blk[0]);
+    CHECK_EQUAL(0b101, blk[1]);
+    CHECK_EQUAL(0, blk[2]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 5));
+}
+
+TEST(recv_wnd, sack_reports_partial_vectors_only_for_flagged_messages)
+{
+    Fixture f;
+    f.rw.w.size = 10;
+    f.msg[1].cur_ack_vec = 0b0011;
+    f.msg[2].cur_ack_vec = 0b0001;
+    f.msg[3].cur_ack_vec = 0b0101;
+    f.msg[4].cur_ack_vec = f.msg[4].full_ack_vec;
+    arq__bits_set(f.rw.ack, 1);
+    arq__bits_set(f.rw.ack, 3);
+    std::array< arq_uchar_t, 32 > blk;
+    CHECK_EQUAL(7u, arq__recv_wnd_sack(&f.rw, 0, blk.data(), blk.size()));
+    CHECK_EQUAL(4, blk[0]);
+    CHECK_EQUAL(0b1000, blk[1]);
+    CHECK_EQUAL(0b0101, blk[2]);
+    CHECK_EQUAL(0x00, blk[3]);
+    CHECK_EQUAL(0b0011, blk[4]);
+    CHECK_EQUAL(0x00, blk[5]);
+    CHECK_EQUAL(0b0101, blk[6]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 1));
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 3));
+}
+
+TEST(recv_wnd, sack_stops_at_messages_that_dont_fit_and_leaves_their_bits_set)
+{
+    Fixture f;
+    f.rw.w.size = 20;
+    for (auto i = 0u; i < 20; ++i) {
+        f.msg[i].cur_ack_vec = f.msg[i].full_ack_vec;
+        arq__bits_set(f.rw.ack, i);
+    }
+    std::array< arq_uchar_t, 3 > blk;
+    CHECK_EQUAL(3u, arq__recv_wnd_sack(&f.rw, 0, blk.data(), blk.size()));
+    CHECK_EQUAL(8, blk[0]);
+    CHECK_EQUAL(0xFF, blk[1]);
+    CHECK_EQUAL(ARQ_FALSE, arq__bits_test(f.rw.ack, 8));
+    CHECK_EQUAL(ARQ_TRUE, arq__bits_test(f.rw.ack, 9));
+}
+
+TEST(recv_wnd, sack_wraps_around_window_capacity)
+{
+    Fixture f;
+    f.rw.w.seq = (arq_uint16_t)(f.rw.w.cap - 1);
+    f.rw.w.size = 3;
+    f.msg[1].cur_ack_vec = f.msg[1].full_ack_vec;
+    std::array< arq_uchar_t, 32 > blk;
+    CHECK_EQUAL(3u, arq__recv_wnd_sack(&f.rw, f.rw.w.cap - 1, blk.data(), blk.size()));
+    CHECK_EQUAL(2, blk[0]);
+    CHECK_EQUAL(0b10, blk[1]);
+}
+
+TEST(recv_wnd, peek_empty_window_returns_zero)
+{
+    Fixture f;
+    void const *p;
+    CHECK_EQUAL(0u, arq__recv_wnd_peek(&f.rw, &p));
+}
+
+TEST(recv_wnd, peek_returns_pointer_to_copy_position_in_buf)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    f.rw.copy_ofs = 3;
+    void const *p;
+    unsigned const len = arq__recv_wnd_peek(&f.rw, &p);
+    POINTERS_EQUAL(&f.buf[3], p);
+    CHECK_EQUAL(f.rw.w.msg_len - 3u, len);
+}
+
+TEST(recv_wnd, peek_spans_consecutive_full_messages)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, (f.rw.w.msg_len * 2) + 5);
+    void const *p;
+    CHECK_EQUAL((f.rw.w.msg_len * 2) + 5u, arq__recv_wnd_peek(&f.rw, &p));
+}
+
+TEST(recv_wnd, peek_stops_at_incomplete_message)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 2);
+    f.msg[1].cur_ack_vec = 0;
+    void const *p;
+    CHECK_EQUAL(f.rw.w.msg_len, arq__recv_wnd_peek(&f.rw, &p));
+}
+
+TEST(recv_wnd, peek_stops_after_tinygram)
+{
+    Fixture f;
+    f.rw.w.size = 2;
+    f.msg[0].len = 1;
+    f.msg[0].cur_ack_vec = f.msg[0].full_ack_vec = 1;
+    f.msg[1].len = f.rw.w.msg_len;
+    f.msg[1].cur_ack_vec = f.msg[1].full_ack_vec = f.rw.w.full_ack_vec;
+    void const *p;
+    CHECK_EQUAL(1u, arq__recv_wnd_peek(&f.rw, &p));
+}
+
+TEST(recv_wnd, peek_stops_at_end_of_buf_when_window_wraps_around_capacity)
+{
+    Fixture f;
+    f.rw.w.seq = f.rw.w.cap - 1;
+    f.rw.copy_seq = f.rw.w.seq;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 2);
+    void const *p;
+    CHECK_EQUAL(f.rw.w.msg_len, arq__recv_wnd_peek(&f.rw, &p));
+    POINTERS_EQUAL(&f.buf[(f.rw.w.cap - 1) * f.rw.w.msg_len], p);
+}
+
+TEST(recv_wnd, consume_partial_msg_advances_copy_ofs)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__recv_wnd_consume(&f.rw, 5);
+    CHECK_EQUAL(5, f.rw.copy_ofs);
+    CHECK_EQUAL(0, f.rw.copy_seq);
+    CHECK_EQUAL(0, f.rw.slide);
+}
+
+TEST(recv_wnd, consume_across_messages_releases_them_like_recv)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 3);
+    arq__recv_wnd_consume(&f.rw, (f.rw.w.msg_len * 2) + 1);
+    CHECK_EQUAL(2, f.rw.copy_seq);
+    CHECK_EQUAL(1, f.rw.copy_ofs);
+    CHECK_EQUAL(2, f.rw.slide);
+    CHECK_EQUAL(0, f.msg[0].len);
+    CHECK_EQUAL(0, f.msg[0].cur_ack_vec);
+    CHECK_EQUAL(0, f.msg[1].len);
+    CHECK_EQUAL(f.rw.w.msg_len, f.msg[2].len);
+}
+
+TEST(recv_wnd, consume_keeps_ack_vectors_of_messages_still_waiting_for_ack)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 2);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len * 2);
+    CHECK_EQUAL(0, f.msg[0].len);
+    CHECK_EQUAL(f.rw.w.full_ack_vec, f.msg[0].cur_ack_vec);
+    CHECK_EQUAL(0, f.msg[1].cur_ack_vec);
+}
+
+TEST(recv_wnd, ack_clr_releases_consumed_message)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len);
+    arq__recv_wnd_ack_clr(&f.rw, 0);
+    CHECK(!arq__bits_test(f.rw.ack, 0));
+    CHECK_EQUAL(0, f.msg[0].cur_ack_vec);
+    CHECK_EQUAL(f.rw.w.full_ack_vec, f.msg[0].full_ack_vec);
+}
+
+TEST(recv_wnd, ack_clr_leaves_unconsumed_message_alone)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_ack_clr(&f.rw, 0);
+    CHECK(!arq__bits_test(f.rw.ack, 0));
+    CHECK_EQUAL(f.rw.w.full_ack_vec, f.msg[0].cur_ack_vec);
+}
+
+TEST(recv_wnd, ack_reports_full_vector_of_consumed_message)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len);
+    unsigned seq;
+    arq_uint16_t vec;
+    CHECK(arq__recv_wnd_ack(&f.rw, &seq, &vec));
+    CHECK_EQUAL(0u, seq);
+    CHECK_EQUAL(f.rw.w.full_ack_vec, vec);
+    CHECK_EQUAL(0, f.msg[0].cur_ack_vec);
+}
+
+TEST(recv_wnd, frame_sliding_past_consumed_message_drops_its_ack)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len);
+    f.seg.resize(1);
+    arq__recv_wnd_frame(&f.rw, f.rw.w.cap, 0, 2, f.seg.data(), f.seg.size(), 0);
+    CHECK(!arq__bits_test(f.rw.ack, 0));
+    CHECK_EQUAL(1, f.msg[0].cur_ack_vec);
+}
+
+TEST(recv_wnd, adv_doesnt_count_consumed_messages_still_waiting_for_ack)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 3);
+    arq__bits_set(f.rw.ack, 1);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len * 3);
+    CHECK_EQUAL(f.rw.w.cap - 2u, arq__recv_wnd_adv(&f.rw, 3));
+}
+
+TEST(recv_wnd, pending_ignores_consumed_message_still_waiting_for_ack)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len);
+    arq__bits_set(f.rw.ack, 0);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len);
+    CHECK_EQUAL(ARQ_FALSE, arq__recv_wnd_pending(&f.rw));
+}
+
+TEST(recv_wnd, rst_clears_pending_window_update)
+{
+    Fixture f;
+    f.rw.adv = ARQ_TRUE;
+    arq__recv_wnd_rst(&f.rw);
+    CHECK(!f.rw.adv);
+    CHECK_EQUAL(f.rw.w.cap, f.rw.adv_end);
+}
+
+TEST(recv_wnd, rst_stops_ack_delay_timer)
+{
+    Fixture f;
+    f.rw.ack_delay_on = ARQ_TRUE;
+    f.rw.ack_saved = 9;
+    arq__recv_wnd_rst(&f.rw);
+    CHECK(!f.rw.ack_delay_on);
+    CHECK_EQUAL(0u, f.rw.ack_saved);
+}
+
+TEST(recv_wnd, acks_counts_messages_waiting_for_ack_inside_window)
+{
+    Fixture f;
+    f.rw.w.seq = 62;
+    f.rw.w.size = 4;
+    arq__bits_set(f.rw.ack, 62);
+    arq__bits_set(f.rw.ack, 1);
+    arq__bits_set(f.rw.ack, 5);
+    CHECK_EQUAL(2u, arq__recv_wnd_acks(&f.rw));
+}
+
+TEST(recv_wnd, seq_widens_low_byte_ahead_of_window)
+{
+    Fixture f;
+    f.rw.w.seq = 0x2F0;
+    CHECK_EQUAL(0x2F0u, arq__recv_wnd_seq(&f.rw, 0xF0));
+    CHECK_EQUAL(0x36Fu, arq__recv_wnd_seq(&f.rw, 0x6F));
+}
+
+TEST(recv_wnd, seq_widens_low_byte_behind_window)
+{
+    Fixture f;
+    f.rw.w.seq = 0x305;
+    CHECK_EQUAL(0x2FFu, arq__recv_wnd_seq(&f.rw, 0xFF));
+    CHECK_EQUAL(0x285u, arq__recv_wnd_seq(&f.rw, 0x85));
+}
+
+TEST(recv_wnd, seq_widens_low_byte_across_sequence_wrap)
+{
+    Fixture f;
+    f.rw.w.seq = ARQ__FRAME_MAX_SEQ_NUM - 1;
+    CHECK_EQUAL(3u, arq__recv_wnd_seq(&f.rw, 0x03));
+    f.rw.w.seq = 2;
+    CHECK_EQUAL((unsigned)ARQ__FRAME_MAX_SEQ_NUM, arq__recv_wnd_seq(&f.rw, 0xFF));
+}
+
+struct PiggybackFixture : Fixture
+{
+    PiggybackFixture()
+    {
+        arq__frame_hdr_init(&sh);
+        sh.seg = ARQ_TRUE;
+        sh.win = ARQ_TRUE;
+        rw.w.size = 3;
+        msg[0].cur_ack_vec = msg[0].full_ack_vec = 1;
+        msg[2].cur_ack_vec = msg[2].full_ack_vec = 1;
+        arq__bits_set(rw.ack, 0);
+        arq__bits_set(rw.ack, 2);
+        rw.ack_delay_on = ARQ_TRUE;
+        rw.ack_delay = 5;
+    }
+    arq__frame_hdr_t sh;
+};
+
+TEST(recv_wnd, piggyback_does_nothing_without_held_acks)
+{
+    PiggybackFixture f;
+    f.rw.ack_delay_on = ARQ_FALSE;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK(!f.sh.ack);
+    CHECK_EQUAL(0u, f.rw.ack_saved);
+}
+
+TEST(recv_wnd, piggyback_acks_oldest_held_message)
+{
+    PiggybackFixture f;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK(f.sh.ack);
+    CHECK_EQUAL(0, f.sh.ack_num);
+    CHECK_EQUAL(1, f.sh.cur_ack_vec);
+    CHECK(!arq__bits_test(f.rw.ack, 0));
+    CHECK_EQUAL(1u, f.rw.ack_saved);
+}
+
+TEST(recv_wnd, piggyback_advertises_window_relative_to_acked_seq)
+{
+    PiggybackFixture f;
+    f.rw.adv_end = 0;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK_EQUAL(f.rw.w.cap, f.sh.win_size);
+    CHECK_EQUAL(0, f.rw.adv_end); /* not advertised until the frame is written */
+}
+
+TEST(recv_wnd, piggyback_keeps_timer_running_while_acks_remain)
+{
+    PiggybackFixture f;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK(f.rw.ack_delay_on);
+    f.sh.ack = ARQ_FALSE;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK_EQUAL(2, f.sh.ack_num);
+    CHECK(!f.rw.ack_delay_on);
+    CHECK_EQUAL(2u, f.rw.ack_saved);
+}
+
+TEST(recv_wnd, piggyback_leaves_existing_ack_alone)
+{
+    PiggybackFixture f;
+    f.sh.ack = ARQ_TRUE;
+    f.sh.ack_num = 77;
+    arq__recv_wnd_piggyback(&f.rw, &f.sh);
+    CHECK_EQUAL(77, f.sh.ack_num);
+    CHECK(arq__bits_test(f.rw.ack, 0));
+}
+
+TEST(recv_wnd, adv_counts_free_messages_from_seq)
+{
+    Fixture f;
+    f.rw.copy_seq = 3;
+    CHECK_EQUAL(f.rw.w.cap - 2u, arq__recv_wnd_adv(&f.rw, 5));
+}
+
+TEST(recv_wnd, adv_wraps_around_max_seq_num)
+{
+    Fixture f;
+    f.rw.copy_seq = ARQ__FRAME_MAX_SEQ_NUM;
+    CHECK_EQUAL(f.rw.w.cap - 1u, arq__recv_wnd_adv(&f.rw, 0));
+}
+
+TEST(recv_wnd, adv_doesnt_change_last_advertisement)
+{
+    Fixture f;
+    f.rw.adv = ARQ_TRUE;
+    f.rw.adv_end = 5;
+    arq__recv_wnd_adv(&f.rw, 0);
+    CHECK(f.rw.adv);
+    CHECK_EQUAL(5, f.rw.adv_end);
+}
+
+TEST(recv_wnd, advertised_remembers_end_of_advertised_window)
+{
+    Fixture f;
+    arq__recv_wnd_advertised(&f.rw, 5, f.rw.w.cap - 2u);
+    CHECK_EQUAL(f.rw.w.cap + 3u, f.rw.adv_end);
+}
+
+TEST(recv_wnd, advertised_wraps_around_max_seq_num)
+{
+    Fixture f;
+    arq__recv_wnd_advertised(&f.rw, ARQ__FRAME_MAX_SEQ_NUM, 2);
+    CHECK_EQUAL(1, f.rw.adv_end);
+}
+
+TEST(recv_wnd, advertised_clears_pending_window_update)
+{
+    Fixture f;
+    f.rw.adv = ARQ_TRUE;
+    arq__recv_wnd_advertised(&f.rw, 0, f.rw.w.cap);
+    CHECK(!f.rw.adv);
+}
+
+TEST(recv_wnd, frame_past_end_of_window_requests_window_update)
+{
+    Fixture f;
+    f.rw.w.size = f.rw.w.cap;
+    f.seg.resize(13);
+    CHECK_EQUAL(0u, arq__recv_wnd_frame(&f.rw, f.rw.w.cap, 0, 1, f.seg.data(), f.seg.size(), 0));
+    CHECK(f.rw.adv);
+}
+
+TEST(recv_wnd, consume_requests_window_update_once_window_opens_by_half)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * f.rw.w.cap);
+    arq__recv_wnd_advertised(&f.rw, 0, arq__recv_wnd_adv(&f.rw, 0));
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len * ((f.rw.w.cap / 2u) - 1u));
+    CHECK(!f.rw.adv);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len);
+    CHECK(f.rw.adv);
+}
+
+TEST(recv_wnd, peek_after_consume_resumes_from_consumed_position)
+{
+    Fixture f;
+    PopulateReceiveWindow(f, f.rw.w.msg_len * 2);
+    arq__recv_wnd_consume(&f.rw, f.rw.w.msg_len + 4);
+    void const *p;
+    CHECK_EQUAL(f.rw.w.msg_len - 4u, arq__recv_wnd_peek(&f.rw, &p));
+    POINTERS_EQUAL(&f.buf[f.rw.w.msg_len + 4], p);
+}
+
 TEST(recv_wnd, pending_returns_false_if_window_is_empty)
 {
     Fixture f;
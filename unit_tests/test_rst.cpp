@@ -27,9 +27,14 @@ void MockSendFrameRst(arq__send_frame_t *f)
     mock().actualCall("arq__send_frame_rst").withParameter("f", f);
 }
 
-void MockRecvFrameRst(arq__recv_frame_t *f)
+void MockRecvRingRst(arq__recv_ring_t *r)
 {
-    mock().actualCall("arq__recv_frame_rst").withParameter("f", f);
+    mock().actualCall("arq__recv_ring_rst").withParameter("r", r);
+}
+
+void MockPacerRst(arq__pacer_t *p)
+{
+    mock().actualCall("arq__pacer_rst").withParameter("p", p);
 }
 
 struct Fixture
@@ -40,7 +45,8 @@ struct Fixture
         ARQ_MOCK_HOOK(arq__recv_wnd_rst, MockRecvWndRst);
         ARQ_MOCK_HOOK(arq__send_wnd_rst, MockSendWndRst);
         ARQ_MOCK_HOOK(arq__send_frame_rst, MockSendFrameRst);
-        ARQ_MOCK_HOOK(arq__recv_frame_rst, MockRecvFrameRst);
+        ARQ_MOCK_HOOK(arq__recv_ring_rst, MockRecvRingRst);
+        ARQ_MOCK_HOOK(arq__pacer_rst, MockPacerRst);
     }
     arq_t arq;
 };
@@ -86,10 +92,18 @@ TEST(rst, resets_send_frame)
     arq__rst(&f.arq);
 }
 
-TEST(rst, resets_recv_frame)
+TEST(rst, resets_recv_ring)
+{
+    Fixture f;
+    mock().expectOneCall("arq__recv_ring_rst").withParameter("r", &f.arq.recv_ring);
+    mock().ignoreOtherCalls();
+    arq__rst(&f.arq);
+}
+
+TEST(rst, resets_pacer)
 {
     Fixture f;
-    mock().expectOneCall("arq__recv_frame_rst").withParameter("f", &f.arq.recv_frame);
+    mock().expectOneCall("arq__pacer_rst").withParameter("p", &f.arq.pacer);
     mock().ignoreOtherCalls();
     arq__rst(&f.arq);
 }
@@ -29,5 +29,12 @@ TEST(seg_len_from_frame_len, seg_len_is_frame_len_minus_overhead)
     CHECK_EQUAL(100 - ARQ__FRAME_COBS_OVERHEAD - ARQ__FRAME_HEADER_SIZE - 4, x);
 }
 
+TEST(seg_len_from_frame_len, jumbo_seg_len_leaves_room_for_a_cobs_code_byte_per_block)
+{
+    unsigned x;
+    arq_seg_len_from_frame_len(4096, &x);
+    CHECK(arq__frame_len(x) <= 4096);
+    CHECK(arq__frame_len(x + 1) > 4096);
 }
 
+}
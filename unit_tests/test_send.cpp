@@ -73,6 +73,111 @@ TEST(send, returns_success)
     CHECK_EQUAL(ARQ_OK_COMPLETED, e);
 }
 
+TEST(send, reserve_invalid_params)
+{
+    void *p;
+    unsigned size;
+    arq_t arq;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_reserve(nullptr, &p, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_reserve(&arq, nullptr, &size));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_reserve(&arq, &p, nullptr));
+}
+
+TEST(send, reserve_need_poll)
+{
+    void *p;
+    unsigned size;
+    arq_t arq;
+    arq.need_poll = ARQ_TRUE;
+    CHECK_EQUAL(ARQ_ERR_POLL_REQUIRED, arq_send_reserve(&arq, &p, &size));
+}
+
+unsigned MockSendWndReserve(arq__send_wnd_t const *sw, void **out_buf)
+{
+    return mock().actualCall("arq__send_wnd_reserve")
+                 .withParameter("sw", sw).withOutputParameter("out_buf", out_buf)
+                 .returnUnsignedIntValue();
+}
+
+void MockSendWndCommit(arq__send_wnd_t *sw, unsigned len, arq_time_t tiny)
+{
+    mock().actualCall("arq__send_wnd_commit")
+          .withParameter("sw", sw).withParameter("len", len).withParameter("tiny", tiny);
+}
+
+struct ReserveFixture : Fixture
+{
+    ReserveFixture()
+    {
+        arq.send_reserved = nullptr;
+        arq.cfg.tinygram_send_delay = 9;
+        ARQ_MOCK_HOOK(arq__send_wnd_reserve, MockSendWndReserve);
+        ARQ_MOCK_HOOK(arq__send_wnd_commit, MockSendWndCommit);
+    }
+    void *p = buf.data();
+};
+
+TEST(send, reserve_returns_span_from_wnd_reserve)
+{
+    ReserveFixture f;
+    void *out = nullptr;
+    unsigned size;
+    mock().expectOneCall("arq__send_wnd_reserve")
+          .withParameter("sw", &f.arq.send_wnd)
+          .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+          .andReturnValue(12u);
+    arq_err_t const e = arq_send_reserve(&f.arq, &out, &size);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, e);
+    POINTERS_EQUAL(f.buf.data(), out);
+    CHECK_EQUAL(12u, size);
+    POINTERS_EQUAL(f.buf.data(), f.arq.send_reserved);
+}
+
+TEST(send, commit_without_reserve_is_invalid)
+{
+    ReserveFixture f;
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(&f.arq, 1));
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(nullptr, 1));
+}
+
+TEST(send, commit_calls_wnd_commit_with_tinygram_delay)
+{
+    ReserveFixture f;
+    f.arq.send_reserved = f.p;
+    mock().expectOneCall("arq__send_wnd_reserve")
+          .withParameter("sw", &f.arq.send_wnd)
+          .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+          .andReturnValue(12u);
+    mock().expectOneCall("arq__send_wnd_commit")
+          .withParameter("sw", &f.arq.send_wnd)
+          .withParameter("len", 5u)
+          .withParameter("tiny", (arq_time_t)9);
+    CHECK_EQUAL(ARQ_OK_COMPLETED, arq_send_commit(&f.arq, 5));
+    POINTERS_EQUAL(nullptr, f.arq.send_reserved);
+}
+
+TEST(send, commit_more_than_reserved_is_invalid)
+{
+    ReserveFixture f;
+    f.arq.send_reserved = f.p;
+    mock().expectOneCall("arq__send_wnd_reserve")
+          .withParameter("sw", &f.arq.send_wnd)
+          .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+          .andReturnValue(4u);
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(&f.arq, 5));
+}
+
+TEST(send, commit_after_write_position_moved_is_invalid)
+{
+    ReserveFixture f;
+    f.arq.send_reserved = &f.buf[1];
+    mock().expectOneCall("arq__send_wnd_reserve")
+          .withParameter("sw", &f.arq.send_wnd)
+          .withOutputParameterReturning("out_buf", &f.p, sizeof(f.p))
+          .andReturnValue(12u);
+    CHECK_EQUAL(ARQ_ERR_INVALID_PARAM, arq_send_commit(&f.arq, 5));
+}
+
 }
 
 
@@ -23,6 +23,60 @@ TEST(send_frame, reset_sets_len_to_zero)
     CHECK_EQUAL(0, f.len);
 }
 
+TEST(send_frame, reset_clears_offset_and_held_length)
+{
+    arq__send_frame_t f;
+    f.ofs = 12;
+    f.held = 34;
+    arq__send_frame_rst(&f);
+    CHECK_EQUAL(0u, f.ofs);
+    CHECK_EQUAL(0u, f.held);
+}
+
+TEST(send_frame, reset_clears_scatter_gather_segment)
+{
+    arq__send_frame_t f;
+    f.seg = &f;
+    arq__send_frame_rst(&f);
+    CHECK_EQUAL((void const *)NULL, f.seg);
+}
+
+TEST(send_frame, flatten_does_nothing_without_scatter_gather_segment)
+{
+    arq_uchar_t buf[4] = { 1, 2, 3, 0 };
+    arq__send_frame_t f;
+    arq__send_frame_rst(&f);
+    f.buf = buf;
+    f.len = sizeof(buf);
+    arq__send_frame_flatten(&f);
+    CHECK_EQUAL(sizeof(buf), f.len);
+}
+
+TEST(send_frame, flatten_splices_segment_between_prefix_and_trailer)
+{
+    arq_uchar_t buf[64] = {};
+    arq_uchar_t const seg[] = { 0xA1, 0xA2, 0xA3 };
+    for (auto i = 0u; i < ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN; ++i) {
+        buf[i] = (arq_uchar_t)(i + 1);
+    }
+    arq__send_frame_t f;
+    arq__send_frame_rst(&f);
+    f.buf = buf;
+    f.len = ARQ__FRAME_IOV_PREFIX_LEN + ARQ__FRAME_IOV_TRAILER_LEN;
+    f.seg = seg;
+    f.seg_len = sizeof(seg);
+    arq__send_frame_flatten(&f);
+    CHECK_EQUAL((void const *)NULL, f.seg);
+    CHECK_EQUAL(ARQ__FRAME_IOV_PREFIX_LEN + sizeof(seg) + ARQ__FRAME_IOV_TRAILER_LEN, f.len);
+    for (auto i = 0u; i < ARQ__FRAME_IOV_PREFIX_LEN; ++i) {
+        CHECK_EQUAL(i + 1, buf[i]);
+    }
+    MEMCMP_EQUAL(seg, &buf[ARQ__FRAME_IOV_PREFIX_LEN], sizeof(seg));
+    for (auto i = 0u; i < ARQ__FRAME_IOV_TRAILER_LEN; ++i) {
+        CHECK_EQUAL(ARQ__FRAME_IOV_PREFIX_LEN + i + 1, buf[ARQ__FRAME_IOV_PREFIX_LEN + sizeof(seg) + i]);
+    }
+}
+
 TEST(send_frame, init_sets_state_to_free)
 {
     arq__send_frame_t f;
@@ -28,6 +28,21 @@ void MockSendWndAck(arq__send_wnd_t *sw, unsigned seq, arq_uint16_t cur_ack_vec)
                                           .withParameter("cur_ack_vec", cur_ack_vec);
 }
 
+void MockSendWndSack(arq__send_wnd_t *sw, unsigned seq, void const *blk, unsigned len)
+{
+    mock().actualCall("arq__send_wnd_sack").withParameter("sw", sw)
+                                           .withParameter("seq", seq)
+                                           .withParameter("blk", blk)
+                                           .withParameter("len", len);
+}
+
+void MockSendWndRwnd(arq__send_wnd_t *sw, unsigned seq, unsigned win)
+{
+    mock().actualCall("arq__send_wnd_rwnd").withParameter("sw", sw)
+                                           .withParameter("seq", seq)
+                                           .withParameter("win", win);
+}
+
 void MockSendWndFlush(arq__send_wnd_t *sw)
 {
     mock().actualCall("arq__send_wnd_flush").withParameter("sw", sw);
@@ -41,13 +56,23 @@ struct Fixture
         arq__frame_hdr_init(&rh);
         sw.w.msg = m.data();
         sw.rtx = rtx.data();
+        sw.tmr = tmr.data();
+        sw.tmr_pos = tmr_pos.data();
+        sw.rdy = rdy.data();
+        sw.sent = sent.data();
+        sw.tx = tx.data();
+        sw.cc_cb = nullptr;
         arq__wnd_init(&sw.w, m.size(), 128, 16);
+        arq__send_wnd_rst(&sw);
+        sw.rto = rtx_timeout;
         arq__send_frame_init(&f, 128);
         arq__send_wnd_ptr_rst(&p);
         sw.tiny_on = 0;
         ARQ_MOCK_HOOK(arq__send_wnd_step, MockSendWndStep);
         ARQ_MOCK_HOOK(arq__send_wnd_ptr_next, MockSendWndPtrNext);
         ARQ_MOCK_HOOK(arq__send_wnd_ack, MockSendWndAck);
+        ARQ_MOCK_HOOK(arq__send_wnd_sack, MockSendWndSack);
+        ARQ_MOCK_HOOK(arq__send_wnd_rwnd, MockSendWndRwnd);
         ARQ_MOCK_HOOK(arq__send_wnd_flush, MockSendWndFlush);
     }
 
@@ -59,6 +84,11 @@ struct Fixture
     arq__frame_hdr_t rh;
     std::array< arq__msg_t, 16 > m;
     std::array< arq_time_t, 16 > rtx;
+    std::array< arq_time_t, 16 > sent;
+    std::array< arq_uchar_t, 16 > tx;
+    std::array< arq_uint16_t, 16 > tmr;
+    std::array< arq_uint16_t, 16 > tmr_pos;
+    std::array< arq_uint32_t, 1 > rdy;
 };
 
 TEST(send_poll, calls_ack_with_recv_header_fields_if_recv_header_contains_ack)
@@ -71,7 +101,77 @@ TEST(send_poll, calls_ack_with_recv_header_fields_if_recv_header_contains_ack)
                                              .withParameter("seq", f.rh.ack_num)
                                              .withParameter("cur_ack_vec", f.rh.cur_ack_vec);
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+}
+
+arq_time_t s_now_at_ack;
+void RecordNowAtAck(arq__send_wnd_t *sw, unsigned, arq_uint16_t)
+{
+    s_now_at_ack = sw->now;
+}
+
+TEST(send_poll, advances_clock_by_dt_before_calling_ack)
+{
+    Fixture f;
+    ARQ_MOCK_HOOK(arq__send_wnd_ack, RecordNowAtAck);
+    f.sw.now = 100;
+    f.rh.ack = 1;
+    s_now_at_ack = 0;
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 40);
+    CHECK_EQUAL(140, s_now_at_ack);
+    CHECK_EQUAL(140, f.sw.now);
+}
+
+TEST(send_poll, calls_sack_with_recv_header_block_before_ack_if_recv_header_contains_sack)
+{
+    Fixture f;
+    arq_uchar_t blk[4];
+    f.rh.ack = 1;
+    f.rh.ack_num = 123;
+    f.rh.cur_ack_vec = 456;
+    f.rh.sack = blk;
+    f.rh.seg_len = sizeof(blk);
+    mock().expectOneCall("arq__send_wnd_sack").withParameter("sw", &f.sw)
+                                              .withParameter("seq", f.rh.ack_num)
+                                              .withParameter("blk", (void const *)blk)
+                                              .withParameter("len", sizeof(blk));
+    mock().expectOneCall("arq__send_wnd_ack").ignoreOtherParameters();
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+}
+
+TEST(send_poll, doesnt_call_sack_if_recv_header_has_no_sack)
+{
+    Fixture f;
+    f.rh.ack = 1;
+    mock().expectNoCall("arq__send_wnd_sack");
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+}
+
+TEST(send_poll, doesnt_call_sack_if_recv_header_also_carries_a_segment)
+{
+    Fixture f;
+    arq_uchar_t blk[4];
+    f.rh.ack = 1;
+    f.rh.seg = 1;
+    f.rh.sack = blk;
+    mock().expectNoCall("arq__send_wnd_sack");
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+}
+
+TEST(send_poll, doesnt_attach_segment_if_send_header_carries_sack)
+{
+    Fixture f;
+    arq_uchar_t blk[4];
+    f.sh.sack = blk;
+    mock().expectNoCall("arq__send_wnd_ptr_next");
+    mock().ignoreOtherCalls();
+    int const emit = arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(0, emit);
+    CHECK(!f.sh.seg);
 }
 
 TEST(send_poll, calls_step_with_dt)
@@ -80,7 +180,7 @@ TEST(send_poll, calls_step_with_dt)
     arq_time_t const dt = 1234;
     mock().expectOneCall("arq__send_wnd_step").withParameter("sw", &f.sw).withParameter("dt", dt);
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, dt, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, dt);
 }
 
 TEST(send_poll, returns_zero_after_stepping_if_send_frame_in_use)
@@ -89,7 +189,7 @@ TEST(send_poll, returns_zero_after_stepping_if_send_frame_in_use)
     f.p.valid = 1;
     f.f.state = ARQ__SEND_FRAME_STATE_HELD;
     mock().expectOneCall("arq__send_wnd_step").ignoreOtherParameters();
-    int const emit = arq__send_poll(&f.sw, &f.f, &f.p, nullptr, &f.rh, 1, f.rtx_timeout);
+    int const emit = arq__send_poll(&f.sw, &f.f, &f.p, nullptr, &f.rh, 1);
     CHECK_EQUAL(0, emit);
 }
 
@@ -108,7 +208,7 @@ TEST(send_poll, flushes_send_window_if_tinygram_timer_enabled_and_expired)
     f.sw.tiny = 0;
     mock().expectOneCall("arq__send_wnd_flush").withParameter("sw", &f.sw);
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1);
 }
 
 TEST(send_poll, disables_tinygram_timer_if_tinygram_timer_enabled_and_expired)
@@ -117,7 +217,7 @@ TEST(send_poll, disables_tinygram_timer_if_tinygram_timer_enabled_and_expired)
     f.sw.tiny_on = 1;
     f.sw.tiny = 0;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1);
     CHECK_EQUAL(0, f.sw.tiny_on);
 }
 
@@ -128,7 +228,7 @@ TEST(send_poll, doesnt_flush_send_window_if_tinygram_timer_enabled_but_not_expir
     f.sw.tiny = 100;
     mock().expectNoCall("arq__send_wnd_flush");
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1);
 }
 
 TEST(send_poll, doesnt_flush_send_window_if_tinygram_timer_disabled)
@@ -137,7 +237,7 @@ TEST(send_poll, doesnt_flush_send_window_if_tinygram_timer_disabled)
     f.sw.tiny_on = 0;
     mock().expectNoCall("arq__send_wnd_flush");
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 1);
 }
 
 TEST(send_poll, advances_send_wnd_ptr_if_frame_is_available)
@@ -146,25 +246,56 @@ TEST(send_poll, advances_send_wnd_ptr_if_frame_is_available)
     mock().expectOneCall("arq__send_wnd_ptr_next")
           .withParameter("p", &f.p)
           .withParameter("sw", (void const *)&f.sw);
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
 }
 
 TEST(send_poll, doesnt_reset_message_retransmission_timer_if_havent_finished_message)
 {
     ExpectSendWndStepFixture f;
-    f.sw.rtx[0] = 1234;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1234);
     mock().expectOneCall("arq__send_wnd_ptr_next").ignoreOtherParameters().andReturnValue(0);
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
-    CHECK_EQUAL(1234, f.sw.rtx[0]);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(1234 - 10, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_poll, resets_message_retransmission_timer_if_finished_sending_message)
 {
     ExpectSendWndStepFixture f;
-    f.sw.rtx[0] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 0, 0);
     mock().expectOneCall("arq__send_wnd_ptr_next").ignoreOtherParameters().andReturnValue(1);
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
-    CHECK_EQUAL(f.rtx_timeout, f.sw.rtx[0]);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(f.rtx_timeout, arq__send_wnd_tmr_left(&f.sw, 0));
+}
+
+TEST(send_poll, records_send_time_when_message_first_finishes_sending)
+{
+    ExpectSendWndStepFixture f;
+    f.sw.now = 500;
+    mock().expectOneCall("arq__send_wnd_ptr_next").ignoreOtherParameters().andReturnValue(1);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(500 + 10, f.sent[0]);
+    CHECK_EQUAL(1, f.tx[0]);
+}
+
+TEST(send_poll, keeps_first_send_time_when_message_is_retransmitted)
+{
+    ExpectSendWndStepFixture f;
+    f.sw.now = 500;
+    f.sent[0] = 300;
+    f.tx[0] = 1;
+    mock().expectOneCall("arq__send_wnd_ptr_next").ignoreOtherParameters().andReturnValue(1);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(300, f.sent[0]);
+    CHECK_EQUAL(2, f.tx[0]);
+}
+
+TEST(send_poll, send_count_saturates_at_two)
+{
+    ExpectSendWndStepFixture f;
+    f.tx[0] = 2;
+    mock().expectOneCall("arq__send_wnd_ptr_next").ignoreOtherParameters().andReturnValue(1);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(2, f.tx[0]);
 }
 
 struct ExpectSendWndPtrNextFixture : ExpectSendWndStepFixture
@@ -178,7 +309,7 @@ struct ExpectSendWndPtrNextFixture : ExpectSendWndStepFixture
 TEST(send_poll, returns_zero_if_no_new_data_to_send)
 {
     ExpectSendWndPtrNextFixture f;
-    int const emit = arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    int const emit = arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(0, emit);
 }
 
@@ -188,7 +319,7 @@ TEST(send_poll, sets_seg_flag_if_send_ptr_valid)
     f.p.valid = 1;
     f.f.state = ARQ__SEND_FRAME_STATE_RELEASED;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK(f.sh.seg);
 }
 
@@ -199,7 +330,7 @@ TEST(send_poll, sets_seq_num_from_send_ptr)
     f.f.state = ARQ__SEND_FRAME_STATE_RELEASED;
     f.p.seq = 123;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(123, f.sh.seq_num);
 }
 
@@ -210,7 +341,7 @@ TEST(send_poll, sets_segment_from_send_ptr)
     f.f.state = ARQ__SEND_FRAME_STATE_RELEASED;
     f.p.seg = 3;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(3, f.sh.seg_id);
 }
 
@@ -225,7 +356,7 @@ TEST(send_poll, sets_msg_len_field_from_message_being_sent_message_is_longer_tha
     f.sw.w.seg_len = 100;
     f.sw.w.msg[0].len = 1000;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(10, f.sh.msg_len);
 }
 
@@ -240,7 +371,7 @@ TEST(send_poll, sets_msg_len_field_from_message_being_sent_message_is_shorter_th
     f.sw.w.seg_len = 100;
     f.sw.w.msg[0].len = 37;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(1, f.sh.msg_len);
 }
 
@@ -255,9 +386,74 @@ TEST(send_poll, sets_msg_len_field_from_message_being_sent_message_is_exactly_on
     f.sw.w.seg_len = 100;
     f.sw.w.msg[0].len = 100;
     mock().ignoreOtherCalls();
-    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10, f.rtx_timeout);
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
     CHECK_EQUAL(1, f.sh.msg_len);
 }
 
+TEST(send_poll, calls_rwnd_with_recv_header_fields_if_recv_header_advertises_window)
+{
+    Fixture f;
+    f.rh.win = 1;
+    f.rh.ack_num = 123;
+    f.rh.win_size = 9;
+    mock().expectOneCall("arq__send_wnd_rwnd").withParameter("sw", &f.sw)
+                                              .withParameter("seq", 123u)
+                                              .withParameter("win", 9u);
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+}
+
+TEST(send_poll, doesnt_call_rwnd_if_recv_header_doesnt_advertise_window)
+{
+    Fixture f;
+    f.rh.ack = 1;
+    mock().expectNoCall("arq__send_wnd_rwnd");
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
 }
 
+TEST(send_poll, starts_probe_timer_if_ready_messages_are_held_back_by_peer_window)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    arq__bits_set(f.sw.rdy, 0);
+    f.sw.rwnd_on = ARQ_TRUE;
+    f.sw.rwnd_end = f.sw.w.seq;
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK(f.sw.probe_on);
+    CHECK_EQUAL(f.rtx_timeout, f.sw.probe);
+}
+
+TEST(send_poll, doesnt_restart_running_probe_timer)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    arq__bits_set(f.sw.rdy, 0);
+    f.sw.probe_on = ARQ_TRUE;
+    f.sw.probe = 5;
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK_EQUAL(5, f.sw.probe);
+}
+
+TEST(send_poll, doesnt_start_probe_timer_if_congestion_window_holds_messages_back)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    arq__bits_set(f.sw.rdy, 1);
+    f.sw.cc.cwnd = 1;
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK(!f.sw.probe_on);
+}
+
+TEST(send_poll, doesnt_start_probe_timer_if_nothing_is_ready)
+{
+    Fixture f;
+    mock().ignoreOtherCalls();
+    arq__send_poll(&f.sw, &f.f, &f.p, &f.sh, &f.rh, 10);
+    CHECK(!f.sw.probe_on);
+}
+
+}
@@ -11,12 +11,27 @@ TEST_GROUP(send_wnd) {};
 
 namespace {
 
+// what arq__send_poll does with each poll's elapsed time
+void Step(arq__send_wnd_t *sw, arq_time_t dt)
+{
+    sw->now += dt;
+    arq__send_wnd_step(sw, dt);
+}
+
 struct NoResetFixture
 {
     NoResetFixture()
     {
         sw.rtx = rtx.data();
+        sw.tmr = tmr.data();
+        sw.tmr_pos = tmr_pos.data();
+        sw.rdy = rdy.data();
+        sw.sent = sent.data();
+        sw.tx = tx.data();
+        sw.cc_cb = nullptr;
         sw.w.msg = msg.data();
+        sw.rto_min = 100;
+        sw.rto_max = 1000;
         arq__wnd_init(&sw.w, msg.size(), 128, 16);
         buf.resize(sw.w.msg_len * sw.w.cap);
         sw.w.buf = buf.data();
@@ -25,6 +40,11 @@ struct NoResetFixture
     arq__send_wnd_t sw;
     std::array< arq__msg_t, 64 > msg;
     std::array< arq_time_t, 64 > rtx;
+    std::array< arq_time_t, 64 > sent;
+    std::array< arq_uchar_t, 64 > tx;
+    std::array< arq_uint16_t, 64 > tmr;
+    std::array< arq_uint16_t, 64 > tmr_pos;
+    std::array< arq_uint32_t, 2 > rdy;
     std::vector< unsigned char > buf;
     std::vector< unsigned char > snd;
 };
@@ -66,14 +86,38 @@ TEST(send_wnd, rst_resets_messages_to_default)
     }
 }
 
-TEST(send_wnd, rst_resets_rtx_to_default)
+TEST(send_wnd, rst_stops_every_retransmission_timer)
 {
     NoResetFixture f;
-    for (auto &t : f.rtx) {
+    for (auto &t : f.tmr_pos) {
         t = 1234;
     }
+    f.sw.tmr_len = 17;
+    f.sw.now = 4321;
+    arq__send_wnd_rst(&f.sw);
+    for (auto const &t : f.tmr_pos) {
+        CHECK_EQUAL(0, t);
+    }
+    CHECK_EQUAL(0u, f.sw.tmr_len);
+    CHECK_EQUAL(0u, f.sw.now);
+}
+
+TEST(send_wnd, rst_resets_retransmission_timeout_to_minimum)
+{
+    NoResetFixture f;
+    f.sw.rto = 555;
+    f.sw.srtt8 = 12;
+    f.sw.rttvar4 = 34;
+    f.sw.rtt_sampled = ARQ_TRUE;
+    for (auto &t : f.tx) {
+        t = 1;
+    }
     arq__send_wnd_rst(&f.sw);
-    for (auto const &t : f.rtx) {
+    CHECK_EQUAL(f.sw.rto_min, f.sw.rto);
+    CHECK_EQUAL(0u, f.sw.srtt8);
+    CHECK_EQUAL(0u, f.sw.rttvar4);
+    CHECK_EQUAL(ARQ_FALSE, f.sw.rtt_sampled);
+    for (auto const &t : f.tx) {
         CHECK_EQUAL(0, t);
     }
 }
@@ -156,9 +200,9 @@ TEST(send_wnd, send_one_full_message_sets_rtx_to_zero)
     Fixture f;
     f.snd.resize(f.sw.w.msg_len);
     f.sw.w.size = 1;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 1);
-    CHECK_EQUAL(0, f.sw.rtx[0]);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_wnd, send_two_messages_sets_rtx_to_zero_for_full_message)
@@ -166,9 +210,9 @@ TEST(send_wnd, send_two_messages_sets_rtx_to_zero_for_full_message)
     Fixture f;
     f.snd.resize(f.sw.w.msg_len + 1);
     f.sw.w.size = 1;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 1);
-    CHECK_EQUAL(0, f.sw.rtx[0]);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_wnd, send_more_than_two_messages_updates_lengths_in_first_three_messages)
@@ -186,10 +230,11 @@ TEST(send_wnd, send_three_messages_sets_rtx_to_zero_for_first_two_messages)
 {
     Fixture f;
     f.snd.resize(f.sw.w.msg_len * 2 + 1);
-    f.sw.rtx[0] = f.sw.rtx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
+    arq__send_wnd_tmr_set(&f.sw, 1, 1);
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 1);
-    CHECK_EQUAL(0, f.sw.rtx[0]);
-    CHECK_EQUAL(0, f.sw.rtx[1]);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 1));
 }
 
 TEST(send_wnd, send_more_than_one_messages_increments_size_by_number_of_messages)
@@ -359,7 +404,7 @@ TEST(send_wnd, send_partial_messages_sets_message_rtx_to_tinygram_timeout)
     Fixture f;
     f.snd.resize(1);
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 79);
-    CHECK_EQUAL(79, f.sw.rtx[0]);
+    CHECK_EQUAL(79, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_wnd, send_partial_messages_nonzero_sets_message_rtx_to_tinygram_timeout)
@@ -372,7 +417,7 @@ TEST(send_wnd, send_partial_messages_nonzero_sets_message_rtx_to_tinygram_timeou
     }
     f.snd.resize(1);
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 79);
-    CHECK_EQUAL(79, f.sw.rtx[6]);
+    CHECK_EQUAL(79, arq__send_wnd_tmr_left(&f.sw, 6));
 }
 
 TEST(send_wnd, send_accumulating_incomplete_message_doesnt_reset_tinygram_timer)
@@ -425,7 +470,116 @@ TEST(send_wnd, send_multiple_calls_accumulating_inside_one_message_doesnt_reset_
     arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 13);
     CHECK_EQUAL(1, f.sw.tiny_on);
     CHECK_EQUAL(13, f.sw.tiny);
-    CHECK_EQUAL(13, f.sw.rtx[0]);
+    CHECK_EQUAL(13, arq__send_wnd_tmr_left(&f.sw, 0));
+}
+
+TEST(send_wnd, reserve_empty_window_returns_start_of_buf)
+{
+    Fixture f;
+    void *p;
+    unsigned const len = arq__send_wnd_reserve(&f.sw, &p);
+    POINTERS_EQUAL(f.buf.data(), p);
+    CHECK_EQUAL(f.sw.w.msg_len * f.sw.w.cap, len);
+}
+
+TEST(send_wnd, reserve_partially_full_message_returns_space_after_message_data)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 7;
+    void *p;
+    unsigned const len = arq__send_wnd_reserve(&f.sw, &p);
+    POINTERS_EQUAL(&f.buf[7], p);
+    CHECK_EQUAL((f.sw.w.msg_len * f.sw.w.cap) - 7, len);
+}
+
+TEST(send_wnd, reserve_stops_at_end_of_buf_when_free_space_wraps)
+{
+    Fixture f;
+    f.sw.w.seq = f.sw.w.cap - 1;
+    f.sw.w.size = 1;
+    f.msg[f.sw.w.cap - 1].len = 3;
+    void *p;
+    unsigned const len = arq__send_wnd_reserve(&f.sw, &p);
+    POINTERS_EQUAL(&f.buf[((f.sw.w.cap - 1) * f.sw.w.msg_len) + 3], p);
+    CHECK_EQUAL(f.sw.w.msg_len - 3, len);
+}
+
+TEST(send_wnd, reserve_wraps_to_start_of_buf_when_last_message_ends_at_end_of_buf)
+{
+    Fixture f;
+    f.sw.w.seq = f.sw.w.cap - 1;
+    f.sw.w.size = 1;
+    f.msg[f.sw.w.cap - 1].len = f.sw.w.msg_len;
+    void *p;
+    unsigned const len = arq__send_wnd_reserve(&f.sw, &p);
+    POINTERS_EQUAL(f.buf.data(), p);
+    CHECK_EQUAL(f.sw.w.msg_len * (f.sw.w.cap - 1), len);
+}
+
+TEST(send_wnd, reserve_full_window_returns_zero)
+{
+    Fixture f;
+    f.sw.w.size = f.sw.w.cap;
+    std::for_each(std::begin(f.msg), std::end(f.msg), [&](arq__msg_t& m) { m.len = f.sw.w.msg_len; });
+    void *p;
+    CHECK_EQUAL(0u, arq__send_wnd_reserve(&f.sw, &p));
+}
+
+TEST(send_wnd, commit_zero_does_nothing)
+{
+    Fixture f;
+    arq__send_wnd_commit(&f.sw, 0, 1);
+    CHECK_EQUAL(0, f.sw.w.size);
+    CHECK_EQUAL(0, f.sw.tiny_on);
+}
+
+TEST(send_wnd, commit_updates_window_like_send)
+{
+    Fixture f, g;
+    f.snd.resize((f.sw.w.msg_len * 2) + 5);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 17);
+    arq__send_wnd_commit(&g.sw, (unsigned)f.snd.size(), 17);
+    CHECK_EQUAL(f.sw.w.size, g.sw.w.size);
+    CHECK_EQUAL(f.sw.tiny_on, g.sw.tiny_on);
+    CHECK_EQUAL(f.sw.tiny, g.sw.tiny);
+    for (auto i = 0u; i < f.sw.w.cap; ++i) {
+        CHECK_EQUAL(f.msg[i].len, g.msg[i].len);
+        CHECK_EQUAL(arq__send_wnd_tmr_left(&f.sw, i), arq__send_wnd_tmr_left(&g.sw, i));
+    }
+}
+
+TEST(send_wnd, commit_after_reserve_publishes_data_written_in_place)
+{
+    Fixture f;
+    void *p;
+    arq__send_wnd_reserve(&f.sw, &p);
+    std::memset(p, 0x5A, 9);
+    arq__send_wnd_commit(&f.sw, 9, 1);
+    CHECK_EQUAL(1, f.sw.w.size);
+    CHECK_EQUAL(9, f.msg[0].len);
+    CHECK_EQUAL(1, f.sw.tiny_on);
+    CHECK_EQUAL(1, arq__send_wnd_tmr_left(&f.sw, 0));
+    CHECK_EQUAL(0x5A, f.buf[8]);
+}
+
+void MockSendWndCommit(arq__send_wnd_t *sw, unsigned len, arq_time_t tiny)
+{
+    mock().actualCall("arq__send_wnd_commit")
+          .withParameter("sw", sw).withParameter("len", len).withParameter("tiny", tiny);
+}
+
+TEST(send_wnd, send_across_wrap_commits_both_spans)
+{
+    Fixture f;
+    f.sw.w.seq = f.sw.w.cap - 1;
+    f.snd.resize(f.sw.w.msg_len + 4);
+    ARQ_MOCK_HOOK(arq__send_wnd_commit, MockSendWndCommit);
+    mock().expectOneCall("arq__send_wnd_commit")
+          .withParameter("sw", &f.sw).withParameter("len", (unsigned)f.sw.w.msg_len).withParameter("tiny", (arq_time_t)3);
+    mock().expectOneCall("arq__send_wnd_commit")
+          .withParameter("sw", &f.sw).withParameter("len", 4u).withParameter("tiny", (arq_time_t)3);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 3);
 }
 
 TEST(send_wnd, ack_seq_outside_of_send_wnd_greater_does_nothing)
@@ -567,9 +721,161 @@ TEST(send_wnd, ack_nak_sets_associated_rtx_to_zero)
     Fixture f;
     f.sw.w.size = 1;
     f.sw.w.msg[0].cur_ack_vec = 0;
-    f.sw.rtx[0] = 100;
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
     arq__send_wnd_ack(&f.sw, 0, f.sw.w.full_ack_vec - 1);
-    CHECK_EQUAL(0, f.sw.rtx[0]);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
+}
+
+TEST(send_wnd, ack_stops_timers_of_retired_messages)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.msg[0].len = f.msg[1].len = f.sw.w.msg_len;
+    f.msg[0].full_ack_vec = f.msg[1].full_ack_vec = f.sw.w.full_ack_vec;
+    f.msg[0].cur_ack_vec = f.msg[1].cur_ack_vec = 0;
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
+    arq__send_wnd_tmr_set(&f.sw, 1, 100);
+    arq__send_wnd_ack(&f.sw, 0, f.sw.w.full_ack_vec);
+    CHECK_EQUAL(1u, f.sw.tmr_len);
+    CHECK_EQUAL(0, f.tmr_pos[0]);
+    CHECK_EQUAL(1, f.tmr[0]);
+}
+
+TEST(send_wnd, sack_acks_complete_messages_without_sliding_past_unacked_first_message)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    for (auto i = 0u; i < 4; ++i) {
+        f.msg[i].len = f.sw.w.msg_len;
+    }
+    arq_uchar_t const blk[] = { 3, 0b011, 0 };
+    arq__send_wnd_sack(&f.sw, 0, blk, sizeof(blk));
+    CHECK_EQUAL(0, f.msg[0].cur_ack_vec);
+    CHECK_EQUAL(f.sw.w.full_ack_vec, f.msg[1].cur_ack_vec);
+    CHECK_EQUAL(f.sw.w.full_ack_vec, f.msg[2].cur_ack_vec);
+    CHECK_EQUAL(0, f.msg[3].cur_ack_vec);
+    CHECK_EQUAL(4, f.sw.w.size);
+}
+
+TEST(send_wnd, sack_then_ack_of_first_message_retires_the_whole_window)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    for (auto i = 0u; i < 4; ++i) {
+        f.msg[i].len = f.sw.w.msg_len;
+    }
+    arq_uchar_t const blk[] = { 3, 0b111, 0 };
+    arq__send_wnd_sack(&f.sw, 0, blk, sizeof(blk));
+    arq__send_wnd_ack(&f.sw, 0, f.sw.w.full_ack_vec);
+    CHECK_EQUAL(0, f.sw.w.size);
+    CHECK_EQUAL(4, f.sw.w.seq);
+}
+
+TEST(send_wnd, sack_applies_partial_vectors_in_order)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    for (auto i = 0u; i < 4; ++i) {
+        f.msg[i].len = f.sw.w.msg_len;
+    }
+    arq__send_wnd_tmr_set(&f.sw, 3, 100);
+    arq_uchar_t const blk[] = { 3, 0b000, 0b101, 0x00, 0x0F, 0x00, 0x03 };
+    arq__send_wnd_sack(&f.sw, 0, blk, sizeof(blk));
+    CHECK_EQUAL(0x0F, f.msg[1].cur_ack_vec);
+    CHECK_EQUAL(0, f.msg[2].cur_ack_vec);
+    CHECK_EQUAL(0x03, f.msg[3].cur_ack_vec);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 3));
+}
+
+TEST(send_wnd, sack_ignores_truncated_block)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    arq_uchar_t const blk[] = { 3, 0b000, 0b001, 0x00 };
+    arq__send_wnd_sack(&f.sw, 0, blk, sizeof(blk));
+    CHECK_EQUAL(0, f.msg[1].cur_ack_vec);
+}
+
+TEST(send_wnd, sack_ignores_messages_outside_of_window)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    arq_uchar_t const blk[] = { 3, 0b111, 0 };
+    arq__send_wnd_sack(&f.sw, 0, blk, sizeof(blk));
+    CHECK_EQUAL(f.sw.w.full_ack_vec, f.msg[1].cur_ack_vec);
+    CHECK_EQUAL(0, f.msg[2].cur_ack_vec);
+    CHECK_EQUAL(2, f.sw.w.size);
+}
+
+TEST(send_wnd, rst_forgets_peer_window)
+{
+    Fixture f;
+    arq__send_wnd_rwnd(&f.sw, 0, 1);
+    arq__send_wnd_rst(&f.sw);
+    CHECK(!f.sw.rwnd_on);
+    CHECK(!f.sw.probe_on);
+    CHECK_EQUAL(f.sw.w.cap, arq__send_wnd_rwnd_limit(&f.sw));
+}
+
+TEST(send_wnd, rwnd_limit_is_window_capacity_until_peer_advertises)
+{
+    Fixture f;
+    CHECK_EQUAL(f.sw.w.cap, arq__send_wnd_rwnd_limit(&f.sw));
+}
+
+TEST(send_wnd, rwnd_limit_counts_messages_from_window_start_to_advertised_edge)
+{
+    Fixture f;
+    f.sw.w.seq = 10;
+    arq__send_wnd_rwnd(&f.sw, 12, 3);
+    CHECK_EQUAL(15, f.sw.rwnd_end);
+    CHECK_EQUAL(5, arq__send_wnd_rwnd_limit(&f.sw));
+}
+
+TEST(send_wnd, rwnd_limit_wraps_around_max_seq_num)
+{
+    Fixture f;
+    f.sw.w.seq = ARQ__FRAME_MAX_SEQ_NUM;
+    arq__send_wnd_rwnd(&f.sw, ARQ__FRAME_MAX_SEQ_NUM, 4);
+    CHECK_EQUAL(3, f.sw.rwnd_end);
+    CHECK_EQUAL(4, arq__send_wnd_rwnd_limit(&f.sw));
+}
+
+TEST(send_wnd, rwnd_limit_is_zero_if_advertised_edge_is_behind_window)
+{
+    Fixture f;
+    f.sw.w.seq = 10;
+    arq__send_wnd_rwnd(&f.sw, 5, 2);
+    CHECK_EQUAL(0, arq__send_wnd_rwnd_limit(&f.sw));
+}
+
+TEST(send_wnd, rwnd_stops_probe_timer)
+{
+    Fixture f;
+    f.sw.probe_on = ARQ_TRUE;
+    arq__send_wnd_rwnd(&f.sw, 0, 0);
+    CHECK(!f.sw.probe_on);
+}
+
+TEST(send_wnd, step_decrements_probe_timer)
+{
+    Fixture f;
+    f.sw.probe_on = ARQ_TRUE;
+    f.sw.probe = 10;
+    Step(&f.sw, 3);
+    CHECK_EQUAL(7, f.sw.probe);
+    CHECK(f.sw.probe_on);
+}
+
+TEST(send_wnd, expired_probe_timer_lets_one_more_message_out)
+{
+    Fixture f;
+    arq__send_wnd_rwnd(&f.sw, 0, 2);
+    f.sw.probe_on = ARQ_TRUE;
+    f.sw.probe = 10;
+    Step(&f.sw, 10);
+    CHECK(!f.sw.probe_on);
+    CHECK_EQUAL(3, arq__send_wnd_rwnd_limit(&f.sw));
 }
 
 TEST(send_wnd, flush_does_nothing_on_empty_window)
@@ -648,42 +954,302 @@ TEST(send_wnd, flush_sets_associated_rtx_to_zero)
     Fixture f;
     f.sw.w.size = 1;
     f.msg[0].len = 10;
-    f.rtx[0] = 100;
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
     arq__send_wnd_flush(&f.sw);
-    CHECK_EQUAL(0, f.rtx[0]);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_wnd, step_decrements_first_timer_in_window_by_dt)
 {
     Fixture f;
     f.sw.w.size = 1;
-    f.sw.rtx[0] = 100;
-    arq__send_wnd_step(&f.sw, 10);
-    CHECK_EQUAL(90, f.sw.rtx[0]);
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(90, arq__send_wnd_tmr_left(&f.sw, 0));
 }
 
 TEST(send_wnd, step_saturates_rtx_to_zero)
 {
     Fixture f;
     f.sw.w.size = 1;
-    f.sw.rtx[0] = 100;
-    arq__send_wnd_step(&f.sw, f.sw.rtx[0] + 1);
-    CHECK_EQUAL(0, f.sw.rtx[0]);
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
+    Step(&f.sw, arq__send_wnd_tmr_left(&f.sw, 0) + 1);
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 0));
+}
+
+TEST(send_wnd, step_decrements_all_running_timers)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
+    arq__send_wnd_tmr_set(&f.sw, 1, 90);
+    arq__send_wnd_tmr_set(&f.sw, 2, 80);
+    arq__send_wnd_tmr_set(&f.sw, 3, 1000);
+    Step(&f.sw, 80);
+    CHECK_EQUAL(20, arq__send_wnd_tmr_left(&f.sw, 0));
+    CHECK_EQUAL(10, arq__send_wnd_tmr_left(&f.sw, 1));
+    CHECK_EQUAL(0, arq__send_wnd_tmr_left(&f.sw, 2));
+    CHECK_EQUAL(920, arq__send_wnd_tmr_left(&f.sw, 3));
 }
 
-TEST(send_wnd, step_decrements_all_timers_in_window)
+TEST(send_wnd, step_makes_expired_messages_due)
 {
     Fixture f;
     f.sw.w.size = 3;
-    f.sw.rtx[0] = 100;
-    f.sw.rtx[1] = 90;
-    f.sw.rtx[2] = 80;
-    f.sw.rtx[3] = 1000;
-    arq__send_wnd_step(&f.sw, 80);
-    CHECK_EQUAL(20, f.sw.rtx[0]);
-    CHECK_EQUAL(10, f.sw.rtx[1]);
-    CHECK_EQUAL(0, f.sw.rtx[2]);
-    CHECK_EQUAL(1000, f.sw.rtx[3]);
+    arq__send_wnd_tmr_set(&f.sw, 0, 30);
+    arq__send_wnd_tmr_set(&f.sw, 1, 10);
+    arq__send_wnd_tmr_set(&f.sw, 2, 20);
+    Step(&f.sw, 20);
+    CHECK_EQUAL(ARQ_FALSE, arq__send_wnd_tmr_due(&f.sw, 0));
+    CHECK_EQUAL(ARQ_TRUE, arq__send_wnd_tmr_due(&f.sw, 1));
+    CHECK_EQUAL(ARQ_TRUE, arq__send_wnd_tmr_due(&f.sw, 2));
+    CHECK_EQUAL(1u, f.sw.tmr_len);
+    CHECK_EQUAL(0, f.tmr[0]);
+}
+
+TEST(send_wnd, step_handles_clock_wraparound)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.sw.now = ARQ_TIME_INFINITY - 5;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 8);
+    CHECK_EQUAL(2, arq__send_wnd_tmr_left(&f.sw, 0));
+    Step(&f.sw, 2);
+    CHECK_EQUAL(ARQ_TRUE, arq__send_wnd_tmr_due(&f.sw, 0));
+}
+
+TEST(send_wnd, tmr_heap_keeps_earliest_deadline_on_top)
+{
+    Fixture f;
+    arq_time_t const t[] = { 50, 20, 70, 10, 60, 30, 40 };
+    for (auto i = 0u; i < sizeof(t) / sizeof(*t); ++i) {
+        arq__send_wnd_tmr_set(&f.sw, i, t[i]);
+    }
+    CHECK_EQUAL(7u, f.sw.tmr_len);
+    CHECK_EQUAL(3, f.tmr[0]);
+    arq__send_wnd_tmr_clr(&f.sw, 3);
+    CHECK_EQUAL(1, f.tmr[0]);
+    arq__send_wnd_tmr_set(&f.sw, 2, 5);
+    CHECK_EQUAL(2, f.tmr[0]);
+    arq__send_wnd_tmr_set(&f.sw, 2, 100);
+    CHECK_EQUAL(1, f.tmr[0]);
+    for (auto i = 0u; i < f.sw.tmr_len; ++i) {
+        CHECK_EQUAL(i + 1, f.tmr_pos[f.tmr[i]]);
+        if (i > 0) {
+            CHECK(f.rtx[f.tmr[(i - 1) / 2]] <= f.rtx[f.tmr[i]]);
+        }
+    }
+}
+
+TEST(send_wnd, commit_marks_full_messages_ready_across_bitmap_words)
+{
+    Fixture f;
+    f.sw.w.seq = 30;
+    f.snd.resize(f.sw.w.msg_len * 4);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 1);
+    CHECK_EQUAL(0xC0000000u, f.rdy[0]);
+    CHECK_EQUAL(0x3u, f.rdy[1]);
+    CHECK_EQUAL(3u, arq__send_wnd_rdy_next(&f.sw, 3));
+}
+
+TEST(send_wnd, tinygram_message_isnt_ready_until_its_timer_expires)
+{
+    Fixture f;
+    f.snd.resize(1);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 10);
+    CHECK_EQUAL(0u, f.rdy[0]);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(1u, f.rdy[0]);
+}
+
+TEST(send_wnd, ack_clears_ready_bits_of_retired_messages)
+{
+    Fixture f;
+    f.snd.resize(f.sw.w.msg_len * 2);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 1);
+    arq__send_wnd_ack(&f.sw, 0, f.sw.w.full_ack_vec);
+    CHECK_EQUAL(0x2u, f.rdy[0]);
+}
+
+TEST(send_wnd, first_rtt_sample_sets_srtt_and_half_of_it_as_variation)
+{
+    Fixture f;
+    arq__send_wnd_rtt_sample(&f.sw, 80);
+    CHECK_EQUAL(80u, f.sw.srtt8 >> 3);
+    CHECK_EQUAL(40u, f.sw.rttvar4 >> 2);
+    CHECK_EQUAL(240u, f.sw.rto);
+}
+
+TEST(send_wnd, later_rtt_samples_are_smoothed)
+{
+    Fixture f;
+    arq__send_wnd_rtt_sample(&f.sw, 80);
+    arq__send_wnd_rtt_sample(&f.sw, 160);
+    CHECK_EQUAL(90u, f.sw.srtt8 >> 3);
+    CHECK_EQUAL(50u, f.sw.rttvar4 >> 2);
+    CHECK_EQUAL(290u, f.sw.rto);
+}
+
+TEST(send_wnd, rtt_sample_doesnt_take_rto_below_minimum)
+{
+    Fixture f;
+    arq__send_wnd_rtt_sample(&f.sw, 1);
+    CHECK_EQUAL(f.sw.rto_min, f.sw.rto);
+}
+
+TEST(send_wnd, rtt_sample_doesnt_take_rto_above_maximum)
+{
+    Fixture f;
+    arq__send_wnd_rtt_sample(&f.sw, 5000);
+    CHECK_EQUAL(f.sw.rto_max, f.sw.rto);
+}
+
+TEST(send_wnd, ack_completing_message_sent_once_samples_rtt)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 1;
+    f.msg[0].full_ack_vec = 1;
+    f.tx[0] = 1;
+    f.sent[0] = 10;
+    f.sw.now = 90;
+    arq__send_wnd_ack(&f.sw, 0, 1);
+    CHECK_EQUAL(ARQ_TRUE, f.sw.rtt_sampled);
+    CHECK_EQUAL(80u, f.sw.srtt8 >> 3);
+}
+
+TEST(send_wnd, ack_of_retransmitted_message_doesnt_sample_rtt)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 1;
+    f.msg[0].full_ack_vec = 1;
+    f.tx[0] = 2;
+    f.sent[0] = 10;
+    f.sw.now = 90;
+    arq__send_wnd_ack(&f.sw, 0, 1);
+    CHECK_EQUAL(ARQ_FALSE, f.sw.rtt_sampled);
+}
+
+TEST(send_wnd, duplicate_ack_doesnt_sample_rtt_twice)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.msg[1].len = 1;
+    f.msg[1].full_ack_vec = 1;
+    f.tx[1] = 1;
+    f.sent[1] = 10;
+    f.sw.now = 90;
+    arq__send_wnd_ack(&f.sw, 1, 1);
+    f.sw.now = 500;
+    arq__send_wnd_ack(&f.sw, 1, 1);
+    CHECK_EQUAL(80u, f.sw.srtt8 >> 3);
+}
+
+TEST(send_wnd, ack_retiring_message_clears_its_send_count)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 1;
+    f.msg[0].full_ack_vec = 1;
+    f.tx[0] = 2;
+    arq__send_wnd_ack(&f.sw, 0, 1);
+    CHECK_EQUAL(0, f.tx[0]);
+}
+
+TEST(send_wnd, step_doubles_rto_once_when_sent_messages_time_out)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.tx[0] = f.tx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    arq__send_wnd_tmr_set(&f.sw, 1, 20);
+    Step(&f.sw, 20);
+    CHECK_EQUAL(200u, f.sw.rto);
+}
+
+TEST(send_wnd, step_backs_off_once_when_burst_times_out_over_several_steps)
+{
+    Fixture f;
+    f.sw.w.size = 4;
+    for (auto i = 0u; i < 4; ++i) {
+        f.tx[i] = 1;
+        arq__send_wnd_tmr_set(&f.sw, i, 10 + i);
+    }
+    for (auto i = 0u; i < 4; ++i) {
+        Step(&f.sw, (i == 0) ? 10 : 1);
+    }
+    CHECK_EQUAL(200u, f.sw.rto);
+}
+
+TEST(send_wnd, step_backs_off_again_when_resent_oldest_message_times_out)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.tx[0] = f.tx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    f.tx[0] = 2;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(400u, f.sw.rto);
+}
+
+TEST(send_wnd, step_doesnt_back_off_again_when_resent_message_behind_oldest_times_out)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.tx[0] = f.tx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    f.tx[1] = 2;
+    arq__send_wnd_tmr_set(&f.sw, 1, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(200u, f.sw.rto);
+}
+
+TEST(send_wnd, step_backs_off_again_once_episode_is_over)
+{
+    Fixture f;
+    f.sw.w.size = 2;
+    f.tx[0] = f.tx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    CHECK(f.sw.cc_rec_on);
+    f.sw.cc_rec_on = ARQ_FALSE;
+    arq__send_wnd_tmr_set(&f.sw, 1, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(400u, f.sw.rto);
+}
+
+TEST(send_wnd, step_backoff_is_capped_at_maximum)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.tx[0] = 1;
+    f.sw.rto = 600;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(f.sw.rto_max, f.sw.rto);
+}
+
+TEST(send_wnd, step_doesnt_back_off_when_tinygram_delay_expires)
+{
+    Fixture f;
+    f.snd.resize(1);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(f.sw.rto_min, f.sw.rto);
+}
+
+TEST(send_wnd, tmr_clr_on_stopped_timer_does_nothing)
+{
+    Fixture f;
+    arq__send_wnd_tmr_set(&f.sw, 4, 10);
+    arq__send_wnd_tmr_clr(&f.sw, 2);
+    CHECK_EQUAL(1u, f.sw.tmr_len);
+    CHECK_EQUAL(10, arq__send_wnd_tmr_left(&f.sw, 4));
 }
 
 TEST(send_wnd, step_operates_on_messages_in_window)
@@ -691,9 +1257,9 @@ TEST(send_wnd, step_operates_on_messages_in_window)
     Fixture f;
     f.sw.w.size = 1;
     f.sw.w.seq = f.sw.w.cap / 2;
-    f.sw.rtx[f.sw.w.seq] = 100;
-    arq__send_wnd_step(&f.sw, 10);
-    CHECK_EQUAL(90, f.sw.rtx[f.sw.w.seq]);
+    arq__send_wnd_tmr_set(&f.sw, f.sw.w.seq, 100);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(90, arq__send_wnd_tmr_left(&f.sw, f.sw.w.seq));
 }
 
 TEST(send_wnd, step_wraps_around_when_window_wraps)
@@ -701,15 +1267,15 @@ TEST(send_wnd, step_wraps_around_when_window_wraps)
     Fixture f;
     f.sw.w.seq = f.sw.w.cap - 2;
     f.sw.w.size = 4;
-    f.sw.rtx[f.sw.w.seq] = 100;
-    f.sw.rtx[f.sw.w.seq + 1] = 90;
-    f.sw.rtx[0] = 80;
-    f.sw.rtx[1] = 70;
-    arq__send_wnd_step(&f.sw, 10);
-    CHECK_EQUAL(90, f.sw.rtx[f.sw.w.seq]);
-    CHECK_EQUAL(80, f.sw.rtx[f.sw.w.seq + 1]);
-    CHECK_EQUAL(70, f.sw.rtx[0]);
-    CHECK_EQUAL(60, f.sw.rtx[1]);
+    arq__send_wnd_tmr_set(&f.sw, f.sw.w.seq, 100);
+    arq__send_wnd_tmr_set(&f.sw, f.sw.w.seq + 1, 90);
+    arq__send_wnd_tmr_set(&f.sw, 0, 80);
+    arq__send_wnd_tmr_set(&f.sw, 1, 70);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(90, arq__send_wnd_tmr_left(&f.sw, f.sw.w.seq));
+    CHECK_EQUAL(80, arq__send_wnd_tmr_left(&f.sw, f.sw.w.seq + 1));
+    CHECK_EQUAL(70, arq__send_wnd_tmr_left(&f.sw, 0));
+    CHECK_EQUAL(60, arq__send_wnd_tmr_left(&f.sw, 1));
 }
 
 TEST(send_wnd, step_decrements_tinygram_timer_if_active)
@@ -717,7 +1283,7 @@ TEST(send_wnd, step_decrements_tinygram_timer_if_active)
     Fixture f;
     f.sw.tiny_on = 1;
     f.sw.tiny = 10;
-    arq__send_wnd_step(&f.sw, 3);
+    Step(&f.sw, 3);
     CHECK_EQUAL(7, f.sw.tiny);
 }
 
@@ -726,7 +1292,7 @@ TEST(send_wnd, step_ignores_tinygram_timer_if_inactive)
     Fixture f;
     f.sw.tiny_on = 0;
     f.sw.tiny = 13;
-    arq__send_wnd_step(&f.sw, 1000);
+    Step(&f.sw, 1000);
     CHECK_EQUAL(13, f.sw.tiny);
 }
 
@@ -735,9 +1301,218 @@ TEST(send_wnd, step_saturates_tiny_to_zero)
     Fixture f;
     f.sw.tiny_on = 1;
     f.sw.tiny = 12;
-    arq__send_wnd_step(&f.sw, 100);
+    Step(&f.sw, 100);
     CHECK_EQUAL(0, f.sw.tiny);
 }
 
+struct CongestionFixture : NoResetFixture
+{
+    CongestionFixture()
+    {
+        events.clear();
+        rtts.clear();
+        sw.cc_cb = &Record;
+        arq__send_wnd_rst(&sw);
+    }
+    static void Record(arq_congestion_t *cc, arq_congestion_event_t event, arq_time_t rtt)
+    {
+        events.push_back(event);
+        rtts.push_back(rtt);
+        if (event == ARQ_CONGESTION_EVENT_RST) {
+            cc->cwnd = 4;
+        }
+    }
+    static std::vector< arq_congestion_event_t > events;
+    static std::vector< arq_time_t > rtts;
+};
+
+std::vector< arq_congestion_event_t > CongestionFixture::events;
+std::vector< arq_time_t > CongestionFixture::rtts;
+
+TEST(send_wnd, rst_without_congestion_callback_opens_whole_window)
+{
+    Fixture f;
+    CHECK_EQUAL(f.sw.w.cap, f.sw.cc.cwnd);
+    CHECK_EQUAL(f.sw.w.cap, f.sw.cc.cap);
+}
+
+TEST(send_wnd, rst_lets_congestion_callback_pick_initial_window)
+{
+    CongestionFixture f;
+    CHECK_EQUAL(1u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_RST, f.events[0]);
+    CHECK_EQUAL(4u, f.sw.cc.cwnd);
+    CHECK(!f.sw.cc_rec_on);
+}
+
+TEST(send_wnd, cc_clamps_window_to_capacity_and_one_message)
+{
+    CongestionFixture f;
+    f.sw.cc_cb = [](arq_congestion_t *cc, arq_congestion_event_t, arq_time_t) { cc->cwnd = 100000; };
+    arq__send_wnd_cc(&f.sw, ARQ_CONGESTION_EVENT_ACK, 1);
+    CHECK_EQUAL(f.sw.w.cap, f.sw.cc.cwnd);
+    f.sw.cc_cb = [](arq_congestion_t *cc, arq_congestion_event_t, arq_time_t) { cc->cwnd = 0; };
+    arq__send_wnd_cc(&f.sw, ARQ_CONGESTION_EVENT_ACK, 1);
+    CHECK_EQUAL(1u, f.sw.cc.cwnd);
+}
+
+TEST(send_wnd, rst_keeps_congestion_user_context)
+{
+    CongestionFixture f;
+    int ctx;
+    f.sw.cc.user = &ctx;
+    arq__send_wnd_rst(&f.sw);
+    CHECK_EQUAL((void *)&ctx, f.sw.cc.user);
+}
+
+TEST(send_wnd, ack_completing_message_reports_ack_with_rtt)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 1;
+    f.msg[0].full_ack_vec = 1;
+    f.tx[0] = 1;
+    f.sent[0] = 10;
+    f.sw.now = 90;
+    arq__send_wnd_ack(&f.sw, 0, 1);
+    CHECK_EQUAL(2u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_ACK, f.events[1]);
+    CHECK_EQUAL(80u, f.rtts[1]);
+}
+
+TEST(send_wnd, ack_of_retransmitted_message_reports_ack_without_rtt)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 1;
+    f.msg[0].full_ack_vec = 1;
+    f.tx[0] = 2;
+    arq__send_wnd_ack(&f.sw, 0, 1);
+    CHECK_EQUAL(2u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_ACK, f.events[1]);
+    CHECK_EQUAL(ARQ_TIME_INFINITY, f.rtts[1]);
+}
+
+TEST(send_wnd, duplicate_ack_reports_ack_once)
+{
+    CongestionFixture f;
+    f.sw.w.size = 2;
+    f.msg[1].len = 1;
+    f.msg[1].full_ack_vec = 1;
+    arq__send_wnd_ack(&f.sw, 1, 1);
+    arq__send_wnd_ack(&f.sw, 1, 1);
+    CHECK_EQUAL(2u, f.events.size());
+}
+
+TEST(send_wnd, ack_vector_with_hole_reports_loss)
+{
+    CongestionFixture f;
+    f.sw.w.size = 3;
+    f.msg[0].len = 3;
+    f.msg[0].full_ack_vec = 0b111;
+    arq__send_wnd_ack(&f.sw, 0, 0b101);
+    CHECK_EQUAL(2u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_LOSS, f.events[1]);
+    CHECK(f.sw.cc_rec_on);
+    CHECK_EQUAL(3, f.sw.cc_rec);
+}
+
+TEST(send_wnd, ack_vector_without_hole_doesnt_report_loss)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 3;
+    f.msg[0].full_ack_vec = 0b111;
+    arq__send_wnd_ack(&f.sw, 0, 0b011);
+    CHECK_EQUAL(1u, f.events.size());
+}
+
+TEST(send_wnd, loss_is_reported_once_per_window_of_data)
+{
+    CongestionFixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < 3; ++i) {
+        f.msg[i].len = 3;
+        f.msg[i].full_ack_vec = 0b111;
+    }
+    arq__send_wnd_ack(&f.sw, 0, 0b101);
+    arq__send_wnd_ack(&f.sw, 2, 0b110);
+    CHECK_EQUAL(2u, f.events.size());
+}
+
+TEST(send_wnd, loss_past_recovery_point_is_reported_again)
+{
+    CongestionFixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < 3; ++i) {
+        f.msg[i].len = 3;
+        f.msg[i].full_ack_vec = 0b111;
+    }
+    arq__send_wnd_ack(&f.sw, 0, 0b101);
+    f.sw.w.size = 4;
+    f.msg[3].len = 3;
+    f.msg[3].full_ack_vec = 0b111;
+    arq__send_wnd_ack(&f.sw, 3, 0b110);
+    CHECK_EQUAL(3u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_LOSS, f.events[2]);
+}
+
+TEST(send_wnd, ack_retiring_recovery_point_ends_loss_episode)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.msg[0].len = 3;
+    f.msg[0].full_ack_vec = 0b111;
+    arq__send_wnd_ack(&f.sw, 0, 0b101);
+    arq__send_wnd_ack(&f.sw, 0, 0b111);
+    CHECK(!f.sw.cc_rec_on);
+}
+
+TEST(send_wnd, step_reports_timeout_once_when_sent_messages_time_out)
+{
+    CongestionFixture f;
+    f.sw.w.size = 2;
+    f.tx[0] = f.tx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    arq__send_wnd_tmr_set(&f.sw, 1, 20);
+    Step(&f.sw, 20);
+    CHECK_EQUAL(2u, f.events.size());
+    CHECK_EQUAL(ARQ_CONGESTION_EVENT_TIMEOUT, f.events[1]);
+    CHECK(f.sw.cc_rec_on);
+}
+
+TEST(send_wnd, step_doesnt_report_timeout_again_when_resent_oldest_message_times_out)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.tx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    f.tx[0] = 2;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(2u, f.events.size());
+}
+
+TEST(send_wnd, step_doesnt_report_timeout_during_loss_episode)
+{
+    CongestionFixture f;
+    f.sw.w.size = 1;
+    f.tx[0] = 2;
+    f.sw.cc_rec_on = ARQ_TRUE;
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(1u, f.events.size());
+}
+
+TEST(send_wnd, step_doesnt_report_timeout_when_tinygram_delay_expires)
+{
+    CongestionFixture f;
+    f.snd.resize(1);
+    arq__send_wnd_send(&f.sw, f.snd.data(), f.snd.size(), 10);
+    Step(&f.sw, 10);
+    CHECK_EQUAL(1u, f.events.size());
+}
+
 }
 
@@ -31,20 +31,39 @@ struct Fixture
     {
         sw.w.msg = m.data();
         sw.rtx = rtx.data();
+        sw.tmr = tmr.data();
+        sw.tmr_pos = tmr_pos.data();
+        sw.rdy = rdy.data();
+        sw.sent = sent.data();
+        sw.tx = tx.data();
+        sw.cc_cb = nullptr;
         arq__send_wnd_ptr_rst(&p);
         arq__wnd_init(&sw.w, m.size(), 128, 16);
         arq__send_wnd_rst(&sw);
     }
+    // tests poke message state directly, so bring the ready bitmap up to date before advancing
+    arq__send_wnd_ptr_next_result_t Next()
+    {
+        for (auto i = 0u; i < sw.w.cap; ++i) {
+            arq__send_wnd_rdy_update(&sw, i);
+        }
+        return arq__send_wnd_ptr_next(&p, &sw);
+    }
     arq__send_wnd_ptr_t p;
     arq__send_wnd_t sw;
     std::array< arq__msg_t, 16 > m;
     std::array< arq_time_t, 16 > rtx;
+    std::array< arq_time_t, 16 > sent;
+    std::array< arq_uchar_t, 16 > tx;
+    std::array< arq_uint16_t, 16 > tmr;
+    std::array< arq_uint16_t, 16 > tmr_pos;
+    std::array< arq_uint32_t, 1 > rdy;
 };
 
 TEST(send_wnd_ptr, next_remains_invalid_if_invalid_and_nothing_to_send)
 {
     Fixture f;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -53,7 +72,7 @@ TEST(send_wnd_ptr, next_changes_to_valid_if_invalid_and_message_in_window)
     Fixture f;
     f.sw.w.size = 1;
     f.sw.w.msg[0].len = f.sw.w.seg_len;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.valid);
 }
 
@@ -63,7 +82,7 @@ TEST(send_wnd_ptr, next_ptr_msg_is_zero_if_first_msg_is_at_index_zero)
     f.sw.w.size = 1;
     f.sw.w.msg[0].len = 4;
     f.p.seq = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.seq);
 }
 
@@ -73,7 +92,7 @@ TEST(send_wnd_ptr, next_ptr_seg_is_zero_if_ptr_was_invalid)
     f.sw.w.size = 1;
     f.sw.w.msg[0].len = 1;
     f.p.seg = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.seg);
 }
 
@@ -81,8 +100,8 @@ TEST(send_wnd_ptr, next_ptr_remains_invalid_if_rtx_of_only_message_is_nonzero)
 {
     Fixture f;
     f.sw.w.msg[0].len = 1;
-    f.sw.rtx[0] = 100;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_tmr_set(&f.sw, 0, 100);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -92,9 +111,9 @@ TEST(send_wnd_ptr, next_ptr_remains_invalid_if_all_messages_have_nonzero_rtx)
     f.sw.w.size = 4;
     for (int i = 0; i < f.sw.w.size; ++i) {
         f.sw.w.msg[i].len = 1;
-        f.sw.rtx[i] = 1;
+        arq__send_wnd_tmr_set(&f.sw, i, 1);
     }
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -102,11 +121,11 @@ TEST(send_wnd_ptr, next_sets_invalid_ptr_to_first_zero_rtx_msg)
 {
     Fixture f;
     f.sw.w.size = 2;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[0].len = 16;
-    f.sw.rtx[1] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 1, 0);
     f.sw.w.msg[1].len = 16;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.seq);
 }
 
@@ -116,7 +135,7 @@ TEST(send_wnd_ptr, next_increments_segment_if_not_at_final_seg)
     f.sw.w.msg[0].len = f.sw.w.seg_len + 1;
     f.sw.w.msg[0].full_ack_vec = 0b11;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.seg);
 }
 
@@ -128,7 +147,7 @@ TEST(send_wnd_ptr, next_can_iterate_across_entire_message)
     f.sw.w.msg[0].full_ack_vec = (1 << (f.sw.w.msg_len / f.sw.w.seg_len)) - 1;
     f.p.valid = 0;
     for (int i = 0; i < (f.sw.w.msg_len / f.sw.w.seg_len); ++i) {
-        arq__send_wnd_ptr_next(&f.p, &f.sw);
+        f.Next();
         CHECK_EQUAL(0, f.p.seq);
         CHECK_EQUAL(i, f.p.seg);
         CHECK_EQUAL(1, f.p.valid);
@@ -140,15 +159,15 @@ TEST(send_wnd_ptr, next_skips_msg_if_all_segs_are_already_acked)
     Fixture f;
     f.sw.w.size = 2;
     f.sw.w.msg[0].len = 1; // being retransmitted
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[0].full_ack_vec = 1;
     f.sw.w.msg[0].cur_ack_vec = 0;
     f.sw.w.msg[1].len = f.sw.w.msg_len; // already fully ACK'd
     f.sw.w.msg[1].full_ack_vec = 0xFF;
     f.sw.w.msg[1].cur_ack_vec = 0xFF;
-    f.sw.rtx[1] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 1, 0);
     f.p.valid = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -157,11 +176,11 @@ TEST(send_wnd_ptr, next_invalid_ptr_skips_acked_segs_in_new_msg)
     Fixture f;
     f.sw.w.size = 1;
     f.sw.w.msg[0].len = f.sw.w.seg_len * 3;
-    f.sw.rtx[0] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 0, 0);
     f.sw.w.msg[0].full_ack_vec = 0b111;
     f.sw.w.msg[0].cur_ack_vec = 0b101;
     f.p.valid = 0;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.valid);
     CHECK_EQUAL(1, f.p.seg);
 }
@@ -170,13 +189,13 @@ TEST(send_wnd_ptr, next_valid_ptr_skips_acked_segs_in_current_msg)
 {
     Fixture f;
     f.sw.w.msg[0].len = f.sw.w.seg_len * 4;
-    f.sw.rtx[0] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 0, 0);
     f.sw.w.msg[0].full_ack_vec = 0b1111;
     f.sw.w.msg[0].cur_ack_vec = 0b1010;
     f.p.valid = 1;
     f.p.seq = 0;
     f.p.seg = 0;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.valid);
     CHECK_EQUAL(2, f.p.seg);
 }
@@ -187,13 +206,13 @@ TEST(send_wnd_ptr, next_increments_msg_index_if_ptr_was_pointing_at_last_segment
     f.sw.w.size = 2;
     f.sw.w.msg[0].len = (f.sw.w.seg_len * 2) + 1;
     f.sw.w.msg[0].full_ack_vec = 0b111;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[1].len = 1;
     f.sw.w.msg[1].full_ack_vec = 1;
     f.p.seq = 0;
     f.p.seg = 2;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.seq);
     CHECK_EQUAL(0, f.p.seg);
     CHECK_EQUAL(1, f.p.valid);
@@ -206,13 +225,13 @@ TEST(send_wnd_ptr, next_wraps_seq_to_zero_from_max)
     f.sw.w.seq = ARQ__FRAME_MAX_SEQ_NUM;
     f.sw.w.msg[f.sw.w.seq % f.sw.w.cap].len = (f.sw.w.seg_len * 2) + 1;
     f.sw.w.msg[f.sw.w.seq % f.sw.w.cap].full_ack_vec = 0b111;
-    f.sw.rtx[f.sw.w.seq % f.sw.w.cap] = 1;
+    arq__send_wnd_tmr_set(&f.sw, f.sw.w.seq % f.sw.w.cap, 1);
     f.p.seq = f.sw.w.seq;
     f.p.seg = 2;
     f.p.valid = 1;
     f.sw.w.msg[(f.sw.w.seq + 1) % f.sw.w.cap].len = 1;
     f.sw.w.msg[(f.sw.w.seq + 1) % f.sw.w.cap].full_ack_vec = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.seq);
     CHECK_EQUAL(0, f.p.seg);
     CHECK_EQUAL(1, f.p.valid);
@@ -225,17 +244,17 @@ TEST(send_wnd_ptr, next_wraps_seq_past_zero_to_first_sendable_message_from_max)
     f.sw.w.seq = ARQ__FRAME_MAX_SEQ_NUM;
     f.sw.w.msg[f.sw.w.seq % f.sw.w.cap].len = (f.sw.w.seg_len * 2) + 1;
     f.sw.w.msg[f.sw.w.seq % f.sw.w.cap].full_ack_vec = 0b111;
-    f.sw.rtx[f.sw.w.seq % f.sw.w.cap] = 1;
+    arq__send_wnd_tmr_set(&f.sw, f.sw.w.seq % f.sw.w.cap, 1);
     f.p.seq = f.sw.w.seq;
     f.p.seg = 2;
     f.p.valid = 1;
     f.sw.w.msg[(f.sw.w.seq + 1) % f.sw.w.cap].len = 1;
     f.sw.w.msg[(f.sw.w.seq + 1) % f.sw.w.cap].full_ack_vec = 1;
-    f.sw.rtx[(f.sw.w.seq + 1) % f.sw.w.cap] = 1;
+    arq__send_wnd_tmr_set(&f.sw, (f.sw.w.seq + 1) % f.sw.w.cap, 1);
     f.sw.w.msg[(f.sw.w.seq + 2) % f.sw.w.cap].len = 1;
     f.sw.w.msg[(f.sw.w.seq + 2) % f.sw.w.cap].full_ack_vec = 1;
-    f.sw.rtx[(f.sw.w.seq + 2) % f.sw.w.cap] = 0;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_tmr_set(&f.sw, (f.sw.w.seq + 2) % f.sw.w.cap, 0);
+    f.Next();
     CHECK_EQUAL(1, f.p.seq);
     CHECK_EQUAL(0, f.p.seg);
     CHECK_EQUAL(1, f.p.valid);
@@ -247,12 +266,12 @@ TEST(send_wnd_ptr, next_changes_to_invalid_if_was_pointing_at_last_segment_of_la
     f.sw.w.size = 2;
     f.sw.w.msg[0].len = 1;
     f.sw.w.msg[0].full_ack_vec = 0b1;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[1].len = f.sw.w.seg_len + 1;
     f.sw.w.msg[1].full_ack_vec = 0b11;
-    f.sw.rtx[1] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 1, 1);
     f.p.seq = f.p.seg = f.p.valid = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -262,14 +281,14 @@ TEST(send_wnd_ptr, next_changes_to_invalid_if_was_pointing_at_last_seg_of_last_m
     f.sw.w.size = 1;
     f.sw.w.msg[0].len = 1;
     f.sw.w.msg[0].full_ack_vec = 1;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[1].len = 1; // out of bounds, f.sw.w.size == 1
     f.sw.w.msg[1].full_ack_vec = 1;
-    f.sw.rtx[1] = 0;
+    arq__send_wnd_tmr_set(&f.sw, 1, 0);
     f.p.valid = 1;
     f.p.seq = 0;
     f.p.seg = 0;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(0, f.p.valid);
 }
 
@@ -282,7 +301,7 @@ TEST(send_wnd_ptr, next_skips_current_message_when_advancing)
     f.sw.w.msg[1].len = 1;
     f.sw.w.msg[1].full_ack_vec = 1;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    f.Next();
     CHECK_EQUAL(1, f.p.seq);
 }
 
@@ -291,7 +310,7 @@ TEST(send_wnd_ptr, next_returns_zero_if_the_pointer_stays_inside_of_current_msg)
     Fixture f;
     f.sw.w.msg[0].len = f.sw.w.seg_len * 3;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_INSIDE_MSG, rv);
 }
 
@@ -300,7 +319,7 @@ TEST(send_wnd_ptr, next_returns_zero_when_pointer_goes_to_last_seg_in_longer_msg
     Fixture f;
     f.sw.w.msg[0].len = f.sw.w.seg_len * 3;
     f.p.seg = f.p.valid = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_INSIDE_MSG, rv);
 }
 
@@ -309,7 +328,7 @@ TEST(send_wnd_ptr, next_returns_zero_when_moving_to_first_msg_from_invalid)
     Fixture f;
     f.sw.w.msg[0].len = 1;
     f.p.valid = 0;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_INSIDE_MSG, rv);
 }
 
@@ -320,7 +339,7 @@ TEST(send_wnd_ptr, next_returns_one_when_ptr_moves_past_msg_with_one_seg)
     f.sw.w.msg[0].len = f.sw.w.msg[0].full_ack_vec = 1;
     f.sw.w.msg[1].len = 1;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_COMPLETED_MSG, rv);
 }
 
@@ -329,12 +348,12 @@ TEST(send_wnd_ptr, next_returns_one_when_ptr_moves_past_last_seg_in_msg)
     Fixture f;
     f.sw.w.size = 2;
     f.sw.w.msg[0].len = f.sw.w.seg_len * 3;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[0].full_ack_vec = 0b111;
     f.sw.w.msg[1].len = 1;
     f.p.seg = 2;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_COMPLETED_MSG, rv);
 }
 
@@ -343,7 +362,7 @@ TEST(send_wnd_ptr, next_returns_one_when_finishing_only_msg)
     Fixture f;
     f.sw.w.msg[0].len = f.sw.w.msg[0].full_ack_vec = 1;
     f.p.valid = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_COMPLETED_MSG, rv);
 }
 
@@ -352,13 +371,108 @@ TEST(send_wnd_ptr, next_returns_one_when_finishing_final_msg)
     Fixture f;
     f.sw.w.size = 2;
     f.sw.w.msg[0].len = f.sw.w.msg[0].full_ack_vec = 1;
-    f.sw.rtx[0] = 1;
+    arq__send_wnd_tmr_set(&f.sw, 0, 1);
     f.sw.w.msg[1].len = f.sw.w.msg[1].full_ack_vec = 1;
     f.p.valid = 1;
     f.p.seq = 1;
-    arq__send_wnd_ptr_next_result_t const rv = arq__send_wnd_ptr_next(&f.p, &f.sw);
+    arq__send_wnd_ptr_next_result_t const rv = f.Next();
     CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_COMPLETED_MSG, rv);
 }
 
+TEST(send_wnd_ptr, next_picks_first_ready_message_from_bitmap)
+{
+    Fixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < f.sw.w.size; ++i) {
+        f.sw.w.msg[i].len = 1;
+        f.sw.w.msg[i].full_ack_vec = 1;
+    }
+    arq__send_wnd_rdy_update(&f.sw, 2);
+    arq__send_wnd_ptr_next(&f.p, &f.sw);
+    CHECK_EQUAL(1, f.p.valid);
+    CHECK_EQUAL(2, f.p.seq);
+}
+
+TEST(send_wnd_ptr, next_doesnt_start_messages_past_peer_window)
+{
+    Fixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < f.sw.w.size; ++i) {
+        f.sw.w.msg[i].len = 1;
+        f.sw.w.msg[i].full_ack_vec = 1;
+    }
+    f.sw.w.msg[0].cur_ack_vec = 1;
+    arq__send_wnd_rwnd(&f.sw, 0, 1);
+    f.Next();
+    CHECK_EQUAL(0, f.p.valid);
 }
 
+TEST(send_wnd_ptr, next_doesnt_start_messages_past_congestion_window)
+{
+    Fixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < f.sw.w.size; ++i) {
+        f.sw.w.msg[i].len = 1;
+        f.sw.w.msg[i].full_ack_vec = 1;
+    }
+    f.sw.w.msg[0].cur_ack_vec = 1;
+    f.sw.cc.cwnd = 1;
+    f.Next();
+    CHECK_EQUAL(0, f.p.valid);
+}
+
+TEST(send_wnd_ptr, next_retransmits_inside_congestion_window)
+{
+    Fixture f;
+    f.sw.w.size = 3;
+    for (auto i = 0u; i < f.sw.w.size; ++i) {
+        f.sw.w.msg[i].len = 1;
+        f.sw.w.msg[i].full_ack_vec = 1;
+    }
+    f.sw.cc.cwnd = 1;
+    f.Next();
+    CHECK_EQUAL(1, f.p.valid);
+    CHECK_EQUAL(0, f.p.seq);
+}
+
+TEST(send_wnd_ptr, next_finishes_current_message_even_if_peer_window_shrinks)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.sw.w.msg[0].len = f.sw.w.seg_len * 2;
+    f.sw.w.msg[0].full_ack_vec = 0b11;
+    f.Next();
+    arq__send_wnd_rwnd(&f.sw, 0, 0);
+    CHECK_EQUAL(ARQ__SEND_WND_PTR_NEXT_INSIDE_MSG, f.Next());
+    CHECK_EQUAL(1, f.p.valid);
+    CHECK_EQUAL(1, f.p.seg);
+}
+
+TEST(send_wnd_ptr, rdy_update_tracks_timer_length_and_acks)
+{
+    Fixture f;
+    f.sw.w.size = 1;
+    f.sw.w.msg[0].len = 1;
+    f.sw.w.msg[0].full_ack_vec = 1;
+    arq__send_wnd_rdy_update(&f.sw, 0);
+    CHECK_EQUAL(1u, f.rdy[0]);
+    arq__send_wnd_tmr_set(&f.sw, 0, 10);
+    CHECK_EQUAL(0u, f.rdy[0]);
+    arq__send_wnd_tmr_clr(&f.sw, 0);
+    CHECK_EQUAL(1u, f.rdy[0]);
+    f.sw.w.msg[0].cur_ack_vec = 1;
+    arq__send_wnd_rdy_update(&f.sw, 0);
+    CHECK_EQUAL(0u, f.rdy[0]);
+}
+
+TEST(send_wnd_ptr, rdy_next_searches_from_window_start_and_wraps)
+{
+    Fixture f;
+    f.sw.w.seq = 14;
+    f.rdy[0] = (1u << 15) | (1u << 3);
+    CHECK_EQUAL(1u, arq__send_wnd_rdy_next(&f.sw, 0));
+    CHECK_EQUAL(5u, arq__send_wnd_rdy_next(&f.sw, 2));
+    CHECK_EQUAL(f.sw.w.cap, arq__send_wnd_rdy_next(&f.sw, 6));
+}
+
+}
@@ -138,5 +138,28 @@ TEST(wnd, seg_buf_pointer_is_message_offset_plus_segment_offset)
     CHECK_EQUAL((void *)&f.buf[(f.w.msg_len * 2) + f.w.seg_len], f.p);
 }
 
+TEST(wnd, idx_wraps_seq_into_capacity)
+{
+    Fixture f;
+    CHECK_EQUAL(0u, arq__wnd_idx(&f.w, 0));
+    CHECK_EQUAL(f.w.cap - 1u, arq__wnd_idx(&f.w, f.w.cap - 1u));
+    CHECK_EQUAL(3u, arq__wnd_idx(&f.w, (f.w.cap * 5u) + 3u));
+}
+
+TEST(wnd, msgs_divides_bytes_by_msg_len)
+{
+    Fixture f;
+    CHECK_EQUAL(0u, arq__wnd_msgs(&f.w, f.w.msg_len - 1u));
+    CHECK_EQUAL(1u, arq__wnd_msgs(&f.w, f.w.msg_len));
+    CHECK_EQUAL(3u, arq__wnd_msgs(&f.w, (f.w.msg_len * 3u) + 7u));
 }
 
+TEST(wnd, segs_divides_bytes_by_seg_len)
+{
+    Fixture f;
+    CHECK_EQUAL(0u, arq__wnd_segs(&f.w, f.w.seg_len - 1u));
+    CHECK_EQUAL(1u, arq__wnd_segs(&f.w, f.w.seg_len));
+    CHECK_EQUAL(5u, arq__wnd_segs(&f.w, (f.w.seg_len * 5u) + 1u));
+}
+
+}